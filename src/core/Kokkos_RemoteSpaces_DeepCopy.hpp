@@ -344,12 +344,16 @@ void view_copy_(const DstType& dst, const SrcType& src) {
   } else if (std::is_same<typename DstType::array_layout,
                           Kokkos::PartitionedLayoutRight>::value ||
              std::is_same<typename DstType::array_layout,
-                          Kokkos::LayoutRight>::value) {
+                          Kokkos::LayoutRight>::value ||
+             Kokkos::Impl::is_right_global_layout<
+                 typename DstType::array_layout>::value) {
     iterate = Kokkos::Iterate::Right;
   } else if (std::is_same<typename DstType::array_layout,
                           Kokkos::PartitionedLayoutLeft>::value ||
              std::is_same<typename DstType::array_layout,
-                          Kokkos::LayoutLeft>::value) {
+                          Kokkos::LayoutLeft>::value ||
+             Kokkos::Impl::is_distributed_layout_left<
+                 typename DstType::array_layout>::value) {
     iterate = Kokkos::Iterate::Left;
   } else if (std::is_same<typename DstType::array_layout,
                           Kokkos::PartitionedLayoutStride>::value ||
@@ -413,6 +417,126 @@ void view_copy_(const DstType& dst, const SrcType& src) {
   }
 }
 
+// Copies between a global remote view and a local view can move one
+// contiguous segment per PE if the rows of dim0 are contiguous on the PE
+// owning them
+template <class RemoteType, class LocalType>
+struct is_bulk_global_copy {
+  using remote_layout = typename RemoteType::array_layout;
+  using local_layout  = typename LocalType::array_layout;
+
+  enum {
+    value =
+        std::is_same<typename RemoteType::traits::specialize,
+                     Kokkos::Experimental::RemoteSpaceSpecializeTag>::value &&
+        !std::is_same<typename LocalType::traits::specialize,
+                      Kokkos::Experimental::RemoteSpaceSpecializeTag>::value &&
+        std::is_same<typename RemoteType::value_type,
+                     typename RemoteType::non_const_value_type>::value &&
+        std::is_same<typename RemoteType::non_const_value_type,
+                     typename LocalType::non_const_value_type>::value &&
+        (std::is_same<remote_layout, Kokkos::LayoutRight>::value ||
+         (is_right_global_layout<remote_layout>::value &&
+          !is_irregular_layout<remote_layout>::value) ||
+         (unsigned(RemoteType::rank) == 1 &&
+          std::is_same<remote_layout, Kokkos::LayoutLeft>::value)) &&
+        (std::is_same<local_layout, Kokkos::LayoutRight>::value ||
+         (unsigned(LocalType::rank) == 1 &&
+          std::is_same<local_layout, Kokkos::LayoutLeft>::value)) &&
+        Kokkos::SpaceAccessibility<
+            typename RemoteType::memory_space::execution_space,
+            typename LocalType::memory_space>::accessible
+  };
+};
+
+// Calls f(i, pe, offset, n) for every run of n rows of dim0 starting at
+// global row i that is stored at row offset on pe
+template <class RemoteType, class F>
+void for_each_global_segment(const RemoteType& remote, const size_t extent,
+                             const F& f) {
+  using layout            = typename RemoteType::array_layout;
+  constexpr size_t ghosts = halo_width<layout>::value;
+  constexpr size_t block  = block_cyclic_size<layout>::value;
+  const auto& map         = remote.impl_map();
+  const size_t local_dim0 = remote.extent(0);
+  const size_t num_pes    = map.impl_num_pes();
+
+  if (extent && !local_dim0)
+    Kokkos::abort("deep_copy: remote view has no rows to copy");
+
+  for (size_t i = 0; i < extent;) {
+    const auto owner = map.compute_dim0_offsets(i);
+    // Rows up to the end of the block or the share of the owning PE
+    size_t n = is_block_cyclic_layout<layout>::value
+                   ? block - i % block
+                   : ghosts + local_dim0 - owner.offset;
+    n = std::min(n, extent - i);
+    if (owner.pe >= num_pes || owner.offset + n > ghosts + local_dim0)
+      Kokkos::abort("deep_copy: view exceeds the global extent of dim0");
+    f(i, int(owner.pe), owner.offset, n);
+    i += n;
+  }
+}
+
+// The rows of dim0 of both views must be contiguous and equally long
+template <class RemoteType, class LocalType>
+void check_bulk_global_copy(const RemoteType& remote, const LocalType& local) {
+  if (remote.impl_map().impl_offset_remote_dim() != 0 ||
+      !remote.span_is_contiguous() || !local.span_is_contiguous() ||
+      remote.stride_0() != local.stride_0())
+    Kokkos::abort(
+        "global_deep_copy: views must be contiguous with rows of equal "
+        "length");
+}
+
+// Stores the rows of src that the calling PE owns in dst
+template <class DstType, class SrcType>
+void bulk_global_copy(
+    const DstType& dst, const SrcType& src,
+    typename std::enable_if<
+        is_bulk_global_copy<DstType, SrcType>::value>::type* = nullptr) {
+  check_bulk_global_copy(dst, src);
+
+  auto space         = Kokkos::Experimental::get_memory_space(dst);
+  const size_t row   = dst.stride_0();
+  const int my_pe    = dst.impl_map().impl_my_pe();
+  const auto& handle = dst.impl_map().handle();
+
+  Kokkos::fence("global_deep_copy: put, pre copy fence");
+  space.fence();
+  for_each_global_segment(
+      dst, src.extent(0),
+      [&](size_t i, int pe, size_t offset, size_t n) {
+        if (pe != my_pe) return;
+        Kokkos::Impl::put_nbi(handle, offset * row, src.data() + i * row,
+                              n * row, pe);
+      });
+  space.fence();
+}
+
+// Fetches all rows of src into dst
+template <class DstType, class SrcType>
+void bulk_global_copy(
+    const DstType& dst, const SrcType& src,
+    typename std::enable_if<
+        is_bulk_global_copy<SrcType, DstType>::value>::type* = nullptr) {
+  check_bulk_global_copy(src, dst);
+
+  auto space         = Kokkos::Experimental::get_memory_space(src);
+  const size_t row   = src.stride_0();
+  const auto& handle = src.impl_map().handle();
+
+  Kokkos::fence("global_deep_copy: get, pre copy fence");
+  space.fence();
+  for_each_global_segment(
+      src, dst.extent(0),
+      [&](size_t i, int pe, size_t offset, size_t n) {
+        Kokkos::Impl::get_nbi(dst.data() + i * row, handle, offset * row,
+                              n * row, pe);
+      });
+  space.fence();
+}
+
 }  // namespace  Impl
 
 // namespace Experimental {
@@ -666,6 +790,26 @@ inline void deep_copy(
                           typename Kokkos::LayoutRight>::value) ||
             (std::is_same<typename src_type::array_layout,
                           typename Kokkos::PartitionedLayoutLeft>::value &&
+             std::is_same<typename dst_type::array_layout,
+                          typename Kokkos::LayoutLeft>::value) ||
+            (Kokkos::Impl::is_right_global_layout<
+                 typename dst_type::array_layout>::value &&
+             !Kokkos::Impl::is_halo_layout<
+                 typename dst_type::array_layout>::value &&
+             std::is_same<typename src_type::array_layout,
+                          typename Kokkos::LayoutRight>::value) ||
+            (Kokkos::Impl::is_right_global_layout<
+                 typename src_type::array_layout>::value &&
+             !Kokkos::Impl::is_halo_layout<
+                 typename src_type::array_layout>::value &&
+             std::is_same<typename dst_type::array_layout,
+                          typename Kokkos::LayoutRight>::value) ||
+            (Kokkos::Impl::is_distributed_layout_left<
+                 typename dst_type::array_layout>::value &&
+             std::is_same<typename src_type::array_layout,
+                          typename Kokkos::LayoutLeft>::value) ||
+            (Kokkos::Impl::is_distributed_layout_left<
+                 typename src_type::array_layout>::value &&
              std::is_same<typename dst_type::array_layout,
                           typename Kokkos::LayoutLeft>::value))) ||
       (dst_type::rank == 1 && src_type::rank == 1) &&
@@ -879,6 +1023,26 @@ inline void deep_copy(
                           typename Kokkos::LayoutRight>::value) ||
             (std::is_same<typename src_type::array_layout,
                           typename Kokkos::PartitionedLayoutLeft>::value &&
+             std::is_same<typename dst_type::array_layout,
+                          typename Kokkos::LayoutLeft>::value) ||
+            (Kokkos::Impl::is_right_global_layout<
+                 typename dst_type::array_layout>::value &&
+             !Kokkos::Impl::is_halo_layout<
+                 typename dst_type::array_layout>::value &&
+             std::is_same<typename src_type::array_layout,
+                          typename Kokkos::LayoutRight>::value) ||
+            (Kokkos::Impl::is_right_global_layout<
+                 typename src_type::array_layout>::value &&
+             !Kokkos::Impl::is_halo_layout<
+                 typename src_type::array_layout>::value &&
+             std::is_same<typename dst_type::array_layout,
+                          typename Kokkos::LayoutRight>::value) ||
+            (Kokkos::Impl::is_distributed_layout_left<
+                 typename dst_type::array_layout>::value &&
+             std::is_same<typename src_type::array_layout,
+                          typename Kokkos::LayoutLeft>::value) ||
+            (Kokkos::Impl::is_distributed_layout_left<
+                 typename src_type::array_layout>::value &&
              std::is_same<typename dst_type::array_layout,
                           typename Kokkos::LayoutLeft>::value))) ||
       (dst_type::rank == 1 && src_type::rank == 1) &&
@@ -932,6 +1096,36 @@ inline void deep_copy(
   }
 }
 
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Collective copy between a global remote view and a non-remote
+ *  view spanning its global dim0.
+ *
+ * Every rank of the communicator of the remote view must call it. Copying
+ * into the non-remote view fetches the whole global view on every rank
+ * with one bulk get per run of rows. Copying from the non-remote view
+ * stores only the rows the calling rank owns, so together the ranks write
+ * the whole view. Kokkos::deep_copy copies the share of the calling rank.
+ */
+template <class DT, class... DP, class ST, class... SP>
+void global_deep_copy(const View<DT, DP...>& dst,
+                      const View<ST, SP...>& src) {
+  using dst_type = View<DT, DP...>;
+  using src_type = View<ST, SP...>;
+
+  static_assert(
+      Kokkos::Impl::is_bulk_global_copy<dst_type, src_type>::value ||
+          Kokkos::Impl::is_bulk_global_copy<src_type, dst_type>::value,
+      "global_deep_copy requires a global remote view with contiguous rows "
+      "and a non-remote view of the same type");
+
+  Kokkos::Impl::bulk_global_copy(dst, src);
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 #endif  // KOKKOS_REMOTESPACES_DEEPCOPY_HPP
@@ -0,0 +1,178 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_GATHER_HPP
+#define KOKKOS_REMOTESPACES_GATHER_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Inspector-executor gather from a global 1D remote view.
+ *
+ * The constructor takes the global indices a kernel reads, for example the
+ * column indices of a sparse matrix. It sorts them by owning PE, drops
+ * duplicates and coalesces neighboring indices into runs. gather() then
+ * fetches every run with one bulk non-blocking get into a dense local
+ * buffer. Entry k of the index list is read as values()(local_index()(k)).
+ * Runs are merged across gaps of up to max_gap unused elements.
+ */
+template <class ViewType>
+class GatherPlan {
+  using traits = typename ViewType::traits;
+  using layout = typename traits::array_layout;
+
+  static_assert(unsigned(traits::rank) == 1,
+                "GatherPlan requires a view of rank 1.");
+  static_assert(
+      std::is_same<layout, Kokkos::LayoutRight>::value ||
+          std::is_same<layout, Kokkos::LayoutLeft>::value ||
+          (Kokkos::Impl::is_right_global_layout<layout>::value &&
+           !Kokkos::Impl::is_irregular_layout<layout>::value),
+      "GatherPlan requires a global layout with a host-side owner lookup.");
+
+  struct Run {
+    int pe;
+    size_t offset;
+    size_t count;
+    size_t slot;
+  };
+
+ public:
+  using value_type   = typename traits::non_const_value_type;
+  using memory_space = typename traits::execution_space::memory_space;
+  using values_type  = Kokkos::View<value_type *, memory_space>;
+  using index_type   = Kokkos::View<size_t *, memory_space>;
+
+  template <class IndexView>
+  GatherPlan(const ViewType &v, const IndexView &indices,
+             const size_t max_gap = 0)
+      : m_view(v) {
+    struct Entry {
+      size_t pe, offset, k;
+    };
+
+    auto h_indices =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), indices);
+    const size_t n  = h_indices.extent(0);
+    const auto &map = v.impl_map();
+
+    std::vector<Entry> entries(n);
+    for (size_t k = 0; k < n; ++k) {
+      const auto owner = map.compute_dim0_offsets(
+          map.impl_offset_remote_dim() + size_t(h_indices(k)));
+      entries[k] = {owner.pe, owner.offset, k};
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) {
+                return a.pe < b.pe || (a.pe == b.pe && a.offset < b.offset);
+              });
+
+    m_local_index = index_type(
+        Kokkos::ViewAllocateWithoutInitializing("GatherPlan::local_index"), n);
+    auto h_local_index = Kokkos::create_mirror_view(m_local_index);
+
+    size_t slots = 0;
+    for (const Entry &e : entries) {
+      if (m_runs.empty() || size_t(m_runs.back().pe) != e.pe ||
+          e.offset > m_runs.back().offset + m_runs.back().count + max_gap) {
+        m_runs.push_back({int(e.pe), e.offset, 1, slots});
+        slots += 1;
+      } else if (e.offset >= m_runs.back().offset + m_runs.back().count) {
+        const size_t grow =
+            e.offset + 1 - m_runs.back().offset - m_runs.back().count;
+        m_runs.back().count += grow;
+        slots += grow;
+      }
+      h_local_index(e.k) =
+          m_runs.back().slot + e.offset - m_runs.back().offset;
+    }
+
+    Kokkos::deep_copy(m_local_index, h_local_index);
+    m_values = values_type(
+        Kokkos::ViewAllocateWithoutInitializing("GatherPlan::values"), slots);
+  }
+
+  /** \brief  Fetches the current values of all gathered indices. Collective
+   * over the PEs of the view */
+  void gather() const {
+    auto space         = Kokkos::Experimental::get_memory_space(m_view);
+    const auto &handle = m_view.impl_map().handle();
+
+    // Complete pending writes to the view on all PEs
+    Kokkos::fence();
+    space.fence();
+
+    for (const Run &run : m_runs)
+      Kokkos::Impl::get_nbi(m_values.data() + run.slot, handle, run.offset,
+                            run.count, run.pe);
+
+    space.fence();
+  }
+
+  /** \brief  Dense buffer of the gathered values */
+  const values_type &values() const { return m_values; }
+
+  /** \brief  Position in values() of each entry of the index list */
+  const index_type &local_index() const { return m_local_index; }
+
+  /** \brief  Number of bulk transfers issued by gather() */
+  size_t num_transfers() const { return m_runs.size(); }
+
+ private:
+  ViewType m_view;
+  std::vector<Run> m_runs;
+  values_type m_values;
+  index_type m_local_index;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_GATHER_HPP
@@ -0,0 +1,98 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_HALO_HPP
+#define KOKKOS_REMOTESPACES_HALO_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Refreshes the ghost rows of a view with a halo layout. Every PE
+ * gets the last rows of the previous PE and the first rows of the next PE
+ * with one bulk transfer each. The first and last PE have no outer
+ * neighbor. Collective over the PEs of the view.
+ */
+template <class DT, class... DP>
+void exchange_halos(const View<DT, DP...> &v) {
+  using traits = ViewTraits<DT, DP...>;
+  static_assert(
+      Kokkos::Impl::is_halo_layout<typename traits::array_layout>::value,
+      "exchange_halos requires a view with a halo layout.");
+
+  constexpr size_t width =
+      Kokkos::Impl::halo_width<typename traits::array_layout>::value;
+  const auto &map    = v.impl_map();
+  const int num_pes  = map.impl_num_pes();
+  const int pe       = map.impl_my_pe();
+  const size_t block = v.extent(0);
+  auto space         = Kokkos::Experimental::get_memory_space(v);
+
+  // Elements per row of dim0
+  const size_t row = map.stride_0();
+
+  if (width > block)
+    Kokkos::abort("exchange_halos requires shares of at least the halo width");
+
+  // Complete pending writes to the owned rows of all PEs
+  Kokkos::fence();
+  space.fence();
+
+  if (pe > 0)
+    Kokkos::Impl::get_nbi(v.data(), map.handle(), block * row, width * row,
+                          pe - 1);
+  if (pe < num_pes - 1)
+    Kokkos::Impl::get_nbi(v.data() + (width + block) * row, map.handle(),
+                          width * row, width * row, pe + 1);
+
+  space.fence();
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_HALO_HPP
@@ -48,6 +48,198 @@
 #include <Kokkos_RemoteSpaces.hpp>
 
 namespace Kokkos {
+namespace Impl {
+
+// PE other than the caller that holds all elements of a view and the handle
+// offset of the first one. pe is -1 if the view lives on the calling PE and
+// -2 if its elements span several PEs
+template <class ViewType>
+KOKKOS_INLINE_FUNCTION auto remote_owner(const ViewType &v)
+    -> decltype(v.impl_map().impl_owner()) {
+  auto owner = v.impl_map().impl_owner();
+  if (owner.pe == v.impl_map().impl_my_pe()) owner.pe = -1;
+  return owner;
+}
+
+// Bulk transfers take the backend handles of both views, which requires
+// non-const values of the same type
+template <class DstType, class SrcType>
+struct is_bulk_local_copy
+    : std::integral_constant<
+          bool, std::is_same<typename DstType::value_type,
+                             typename SrcType::value_type>::value &&
+                    std::is_same<typename SrcType::value_type,
+                                 typename SrcType::non_const_value_type>::
+                        value> {};
+
+// Moves the span of src to dst if one of them lives on another PE.
+// Views with the NonBlocking trait complete at the next fence
+template <class DstType, class SrcType, class Owner>
+KOKKOS_INLINE_FUNCTION void local_deep_copy_span(const DstType &dst,
+                                                 const SrcType &src,
+                                                 const Owner &dst_owner,
+                                                 const Owner &src_owner) {
+  using dst_traits = RemoteSpaces_MemoryTraits<typename DstType::memory_traits>;
+  using src_traits = RemoteSpaces_MemoryTraits<typename SrcType::memory_traits>;
+  const size_t n   = src.span();
+  if (dst_owner.pe < 0) {
+    auto *ptr = dst.data() + dst_owner.offset;
+    if (src_traits::is_nonblocking)
+      get_nbi(ptr, src.impl_map().handle(), src_owner.offset, n, src_owner.pe);
+    else
+      get_bulk(ptr, src.impl_map().handle(), src_owner.offset, n,
+               src_owner.pe);
+  } else {
+    const auto *ptr = src.data() + src_owner.offset;
+    if (dst_traits::is_nonblocking)
+      put_nbi(dst.impl_map().handle(), dst_owner.offset, ptr, n, dst_owner.pe);
+    else
+      put_bulk(dst.impl_map().handle(), dst_owner.offset, ptr, n,
+               dst_owner.pe);
+  }
+}
+
+// Moves n elements spaced by strides starting at element offsets of dst and
+// src with one transfer. Exactly one of the views lives on another PE
+template <class DstType, class SrcType, class Owner>
+KOKKOS_INLINE_FUNCTION void local_deep_copy_strided(
+    const DstType &dst, const SrcType &src, const Owner &dst_owner,
+    const Owner &src_owner, const size_t dst_offset, const size_t src_offset,
+    const ptrdiff_t dst_stride, const ptrdiff_t src_stride, const size_t n) {
+  if (dst_owner.pe < 0)
+    get_strided(dst.data() + dst_owner.offset + dst_offset, dst_stride,
+                src.impl_map().handle(), src_owner.offset + src_offset,
+                src_stride, n, src_owner.pe);
+  else
+    put_strided(dst.impl_map().handle(), dst_owner.offset + dst_offset,
+                dst_stride, src.data() + src_owner.offset + src_offset,
+                src_stride, n, dst_owner.pe);
+}
+
+// Copies between views whose elements each live on a single PE. Contiguous
+// views move with one transfer and strided rank-1 and rank-2 views with one
+// transfer per row if one of them lives on another PE; a single team member
+// issues the transfers. Copies between two other PEs go element by element.
+// Returns false if the copy has to go through the view accessors
+template <class TeamType, class DT, class... DP, class ST, class... SP>
+KOKKOS_INLINE_FUNCTION bool local_deep_copy_bulk(
+    const TeamType &team, const View<DT, DP...> &dst,
+    const View<ST, SP...> &src,
+    typename std::enable_if<is_bulk_local_copy<
+        View<DT, DP...>, View<ST, SP...>>::value>::type * = nullptr) {
+  const auto dst_owner = remote_owner(dst);
+  const auto src_owner = remote_owner(src);
+  if (dst_owner.pe == -2 || src_owner.pe == -2) return false;
+  const bool contiguous = dst.span_is_contiguous() && src.span_is_contiguous();
+  if (!contiguous) {
+    if (unsigned(View<DT, DP...>::rank) > 2 ||
+        (dst_owner.pe < 0) == (src_owner.pe < 0))
+      return false;
+    Kokkos::single(Kokkos::PerTeam(team), [&]() {
+      if (unsigned(View<DT, DP...>::rank) == 1)
+        local_deep_copy_strided(dst, src, dst_owner, src_owner, 0, 0,
+                                dst.stride(0), src.stride(0), dst.extent(0));
+      else
+        for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
+          local_deep_copy_strided(dst, src, dst_owner, src_owner,
+                                  i0 * dst.stride(0), i0 * src.stride(0),
+                                  dst.stride(1), src.stride(1), dst.extent(1));
+    });
+    return true;
+  }
+  if (dst_owner.pe < 0 && src_owner.pe < 0) {
+    auto *dst_ptr       = dst.data() + dst_owner.offset;
+    const auto *src_ptr = src.data() + src_owner.offset;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, src.span()),
+                         [&](const size_t i) { dst_ptr[i] = src_ptr[i]; });
+    return true;
+  }
+  if (dst_owner.pe >= 0 && src_owner.pe >= 0) {
+    const auto &dst_handle = dst.impl_map().handle();
+    const auto &src_handle = src.impl_map().handle();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, src.span()),
+                         [&](const size_t i) {
+                           const typename View<DT, DP...>::value_type val =
+                               src_handle(src_owner.pe, src_owner.offset + i);
+                           dst_handle(dst_owner.pe, dst_owner.offset + i) = val;
+                         });
+    return true;
+  }
+  Kokkos::single(Kokkos::PerTeam(team), [&]() {
+    local_deep_copy_span(dst, src, dst_owner, src_owner);
+  });
+  return true;
+}
+
+template <class DT, class... DP, class ST, class... SP>
+KOKKOS_INLINE_FUNCTION bool local_deep_copy_bulk(
+    const View<DT, DP...> &dst, const View<ST, SP...> &src,
+    typename std::enable_if<is_bulk_local_copy<
+        View<DT, DP...>, View<ST, SP...>>::value>::type * = nullptr) {
+  const auto dst_owner = remote_owner(dst);
+  const auto src_owner = remote_owner(src);
+  if (dst_owner.pe == -2 || src_owner.pe == -2) return false;
+  const bool contiguous = dst.span_is_contiguous() && src.span_is_contiguous();
+  if (!contiguous) {
+    if (unsigned(View<DT, DP...>::rank) > 2 ||
+        (dst_owner.pe < 0) == (src_owner.pe < 0))
+      return false;
+    if (unsigned(View<DT, DP...>::rank) == 1)
+      local_deep_copy_strided(dst, src, dst_owner, src_owner, 0, 0,
+                              dst.stride(0), src.stride(0), dst.extent(0));
+    else
+      for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
+        local_deep_copy_strided(dst, src, dst_owner, src_owner,
+                                i0 * dst.stride(0), i0 * src.stride(0),
+                                dst.stride(1), src.stride(1), dst.extent(1));
+    return true;
+  }
+  if (dst_owner.pe < 0 && src_owner.pe < 0) {
+    auto *dst_ptr       = dst.data() + dst_owner.offset;
+    const auto *src_ptr = src.data() + src_owner.offset;
+    for (size_t i = 0; i < src.span(); ++i) dst_ptr[i] = src_ptr[i];
+    return true;
+  }
+  if (dst_owner.pe >= 0 && src_owner.pe >= 0) {
+    const auto &dst_handle = dst.impl_map().handle();
+    const auto &src_handle = src.impl_map().handle();
+    for (size_t i = 0; i < src.span(); ++i) {
+      const typename View<DT, DP...>::value_type val =
+          src_handle(src_owner.pe, src_owner.offset + i);
+      dst_handle(dst_owner.pe, dst_owner.offset + i) = val;
+    }
+    return true;
+  }
+  local_deep_copy_span(dst, src, dst_owner, src_owner);
+  return true;
+}
+
+// Contiguous views whose elements do not span several PEs copy as one span
+template <class DstType, class SrcType>
+KOKKOS_INLINE_FUNCTION bool is_contiguous_local_copy(const DstType &dst,
+                                                     const SrcType &src) {
+  return dst.span_is_contiguous() && src.span_is_contiguous() &&
+         remote_owner(dst).pe != -2 && remote_owner(src).pe != -2;
+}
+
+template <class TeamType, class DT, class... DP, class ST, class... SP>
+KOKKOS_INLINE_FUNCTION bool local_deep_copy_bulk(
+    const TeamType &, const View<DT, DP...> &, const View<ST, SP...> &,
+    typename std::enable_if<!is_bulk_local_copy<
+        View<DT, DP...>, View<ST, SP...>>::value>::type * = nullptr) {
+  return false;
+}
+
+template <class DT, class... DP, class ST, class... SP>
+KOKKOS_INLINE_FUNCTION bool local_deep_copy_bulk(
+    const View<DT, DP...> &, const View<ST, SP...> &,
+    typename std::enable_if<!is_bulk_local_copy<
+        View<DT, DP...>, View<ST, SP...>>::value>::type * = nullptr) {
+  return false;
+}
+
+}  // namespace Impl
+
 namespace Experimental {
 namespace RemoteSpaces {
 
@@ -76,8 +268,9 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy_contiguous(
          std::is_same<typename ViewTraits<ST, SP...>::specialize,
                       Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
         type * = nullptr) {
+  if (Kokkos::Impl::local_deep_copy_bulk(team, dst, src)) return;
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, src.span()),
-                       [&](const int &i) { dst.data()[i] = src.data()[i]; });
+                       [&](const size_t i) { dst.data()[i] = src.data()[i]; });
 }
 
 template <class DT, class... DP, class ST, class... SP>
@@ -89,6 +282,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy_contiguous(
          std::is_same<typename ViewTraits<ST, SP...>::specialize,
                       Kokkos::Experimental::RemoteSpaceSpecializeTag>::value)>::
         type * = nullptr) {
+  if (Kokkos::Impl::local_deep_copy_bulk(dst, src)) return;
   for (size_t i = 0; i < src.span(); ++i) {
     dst.data()[i] = src.data()[i];
   }
@@ -105,7 +299,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy_contiguous(
 
 ) {
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, dst.span()),
-                       [&](const int &i) { dst.data()[i] = value; });
+                       [&](const size_t i) { dst.data()[i] = value; });
 }
 
 template <class DT, class... DP>
@@ -142,8 +336,9 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   const size_t N = dst.extent(0);
 
   team.team_barrier();
-  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N),
-                       [&](const int &i) { dst(i) = src(i); });
+  if (!Kokkos::Impl::local_deep_copy_bulk(team, dst, src))
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N),
+                         [&](const size_t i) { dst(i) = src(i); });
   team.team_barrier();
 }
 
@@ -165,18 +360,20 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
 
   const size_t N = dst.extent(0) * dst.extent(1);
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     team.team_barrier();
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
                                                                    src);
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0      = i % dst.extent(0);
-      int i1      = i / dst.extent(0);
-      dst(i0, i1) = src(i0, i1);
-    });
+    if (!Kokkos::Impl::local_deep_copy_bulk(team, dst, src))
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N),
+                           [&](const size_t i) {
+                             size_t i0   = i % dst.extent(0);
+                             size_t i1   = i / dst.extent(0);
+                             dst(i0, i1) = src(i0, i1);
+                           });
     team.team_barrier();
   }
 }
@@ -199,18 +396,18 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
 
   const size_t N = dst.extent(0) * dst.extent(1) * dst.extent(2);
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     team.team_barrier();
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
                                                                    src);
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0          = i % dst.extent(0);
-      int itmp        = i / dst.extent(0);
-      int i1          = itmp % dst.extent(1);
-      int i2          = itmp / dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0       = i % dst.extent(0);
+      size_t itmp     = i / dst.extent(0);
+      size_t i1       = itmp % dst.extent(1);
+      size_t i2       = itmp / dst.extent(1);
       dst(i0, i1, i2) = src(i0, i1, i2);
     });
     team.team_barrier();
@@ -236,20 +433,20 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   const size_t N =
       dst.extent(0) * dst.extent(1) * dst.extent(2) * dst.extent(3);
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     team.team_barrier();
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
                                                                    src);
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0              = i % dst.extent(0);
-      int itmp            = i / dst.extent(0);
-      int i1              = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0           = i % dst.extent(0);
+      size_t itmp         = i / dst.extent(0);
+      size_t i1           = itmp % dst.extent(1);
       itmp                = itmp / dst.extent(1);
-      int i2              = itmp % dst.extent(2);
-      int i3              = itmp / dst.extent(2);
+      size_t i2           = itmp % dst.extent(2);
+      size_t i3           = itmp / dst.extent(2);
       dst(i0, i1, i2, i3) = src(i0, i1, i2, i3);
     });
     team.team_barrier();
@@ -275,22 +472,22 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   const size_t N = dst.extent(0) * dst.extent(1) * dst.extent(2) *
                    dst.extent(3) * dst.extent(4);
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     team.team_barrier();
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
                                                                    src);
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0                  = i % dst.extent(0);
-      int itmp                = i / dst.extent(0);
-      int i1                  = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0               = i % dst.extent(0);
+      size_t itmp             = i / dst.extent(0);
+      size_t i1               = itmp % dst.extent(1);
       itmp                    = itmp / dst.extent(1);
-      int i2                  = itmp % dst.extent(2);
+      size_t i2               = itmp % dst.extent(2);
       itmp                    = itmp / dst.extent(2);
-      int i3                  = itmp % dst.extent(3);
-      int i4                  = itmp / dst.extent(3);
+      size_t i3               = itmp % dst.extent(3);
+      size_t i4               = itmp / dst.extent(3);
       dst(i0, i1, i2, i3, i4) = src(i0, i1, i2, i3, i4);
     });
     team.team_barrier();
@@ -316,24 +513,24 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
   const size_t N = dst.extent(0) * dst.extent(1) * dst.extent(2) *
                    dst.extent(3) * dst.extent(4) * dst.extent(5);
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     team.team_barrier();
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
                                                                    src);
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0                      = i % dst.extent(0);
-      int itmp                    = i / dst.extent(0);
-      int i1                      = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0                   = i % dst.extent(0);
+      size_t itmp                 = i / dst.extent(0);
+      size_t i1                   = itmp % dst.extent(1);
       itmp                        = itmp / dst.extent(1);
-      int i2                      = itmp % dst.extent(2);
+      size_t i2                   = itmp % dst.extent(2);
       itmp                        = itmp / dst.extent(2);
-      int i3                      = itmp % dst.extent(3);
+      size_t i3                   = itmp % dst.extent(3);
       itmp                        = itmp / dst.extent(3);
-      int i4                      = itmp % dst.extent(4);
-      int i5                      = itmp / dst.extent(4);
+      size_t i4                   = itmp % dst.extent(4);
+      size_t i5                   = itmp / dst.extent(4);
       dst(i0, i1, i2, i3, i4, i5) = src(i0, i1, i2, i3, i4, i5);
     });
     team.team_barrier();
@@ -360,26 +557,26 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
                    dst.extent(3) * dst.extent(4) * dst.extent(5) *
                    dst.extent(6);
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     team.team_barrier();
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(team, dst,
                                                                    src);
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0                          = i % dst.extent(0);
-      int itmp                        = i / dst.extent(0);
-      int i1                          = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0                       = i % dst.extent(0);
+      size_t itmp                     = i / dst.extent(0);
+      size_t i1                       = itmp % dst.extent(1);
       itmp                            = itmp / dst.extent(1);
-      int i2                          = itmp % dst.extent(2);
+      size_t i2                       = itmp % dst.extent(2);
       itmp                            = itmp / dst.extent(2);
-      int i3                          = itmp % dst.extent(3);
+      size_t i3                       = itmp % dst.extent(3);
       itmp                            = itmp / dst.extent(3);
-      int i4                          = itmp % dst.extent(4);
+      size_t i4                       = itmp % dst.extent(4);
       itmp                            = itmp / dst.extent(4);
-      int i5                          = itmp % dst.extent(5);
-      int i6                          = itmp / dst.extent(5);
+      size_t i5                       = itmp % dst.extent(5);
+      size_t i6                       = itmp / dst.extent(5);
       dst(i0, i1, i2, i3, i4, i5, i6) = src(i0, i1, i2, i3, i4, i5, i6);
     });
     team.team_barrier();
@@ -403,6 +600,8 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
+  if (Kokkos::Impl::local_deep_copy_bulk(dst, src)) return;
+
   const size_t N = dst.extent(0);
 
   for (size_t i = 0; i < N; ++i) {
@@ -425,9 +624,9 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
-  } else {
+  } else if (!Kokkos::Impl::local_deep_copy_bulk(dst, src)) {
     for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
       for (size_t i1 = 0; i1 < dst.extent(1); ++i1) dst(i0, i1) = src(i0, i1);
   }
@@ -448,7 +647,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
   } else {
     for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
@@ -473,7 +672,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
   } else {
     for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
@@ -499,7 +698,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
   } else {
     for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
@@ -526,7 +725,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
   } else {
     for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
@@ -554,7 +753,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     return;
   }
 
-  if (dst.span_is_contiguous() && src.span_is_contiguous()) {
+  if (Kokkos::Impl::is_contiguous_local_copy(dst, src)) {
     Kokkos::Experimental::RemoteSpaces::local_deep_copy_contiguous(dst, src);
   } else {
     for (size_t i0 = 0; i0 < dst.extent(0); ++i0)
@@ -588,7 +787,7 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
 
   team.team_barrier();
   Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N),
-                       [&](const int &i) { dst(i) = value; });
+                       [&](const size_t i) { dst(i) = value; });
   team.team_barrier();
 }
 
@@ -614,9 +813,9 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0      = i % dst.extent(0);
-      int i1      = i / dst.extent(0);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0   = i % dst.extent(0);
+      size_t i1   = i / dst.extent(0);
       dst(i0, i1) = value;
     });
     team.team_barrier();
@@ -645,11 +844,11 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0          = i % dst.extent(0);
-      int itmp        = i / dst.extent(0);
-      int i1          = itmp % dst.extent(1);
-      int i2          = itmp / dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0       = i % dst.extent(0);
+      size_t itmp     = i / dst.extent(0);
+      size_t i1       = itmp % dst.extent(1);
+      size_t i2       = itmp / dst.extent(1);
       dst(i0, i1, i2) = value;
     });
     team.team_barrier();
@@ -679,13 +878,13 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0              = i % dst.extent(0);
-      int itmp            = i / dst.extent(0);
-      int i1              = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0           = i % dst.extent(0);
+      size_t itmp         = i / dst.extent(0);
+      size_t i1           = itmp % dst.extent(1);
       itmp                = itmp / dst.extent(1);
-      int i2              = itmp % dst.extent(2);
-      int i3              = itmp / dst.extent(2);
+      size_t i2           = itmp % dst.extent(2);
+      size_t i3           = itmp / dst.extent(2);
       dst(i0, i1, i2, i3) = value;
     });
     team.team_barrier();
@@ -715,15 +914,15 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0                  = i % dst.extent(0);
-      int itmp                = i / dst.extent(0);
-      int i1                  = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0               = i % dst.extent(0);
+      size_t itmp             = i / dst.extent(0);
+      size_t i1               = itmp % dst.extent(1);
       itmp                    = itmp / dst.extent(1);
-      int i2                  = itmp % dst.extent(2);
+      size_t i2               = itmp % dst.extent(2);
       itmp                    = itmp / dst.extent(2);
-      int i3                  = itmp % dst.extent(3);
-      int i4                  = itmp / dst.extent(3);
+      size_t i3               = itmp % dst.extent(3);
+      size_t i4               = itmp / dst.extent(3);
       dst(i0, i1, i2, i3, i4) = value;
     });
     team.team_barrier();
@@ -753,17 +952,17 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0                      = i % dst.extent(0);
-      int itmp                    = i / dst.extent(0);
-      int i1                      = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0                   = i % dst.extent(0);
+      size_t itmp                 = i / dst.extent(0);
+      size_t i1                   = itmp % dst.extent(1);
       itmp                        = itmp / dst.extent(1);
-      int i2                      = itmp % dst.extent(2);
+      size_t i2                   = itmp % dst.extent(2);
       itmp                        = itmp / dst.extent(2);
-      int i3                      = itmp % dst.extent(3);
+      size_t i3                   = itmp % dst.extent(3);
       itmp                        = itmp / dst.extent(3);
-      int i4                      = itmp % dst.extent(4);
-      int i5                      = itmp / dst.extent(4);
+      size_t i4                   = itmp % dst.extent(4);
+      size_t i5                   = itmp / dst.extent(4);
       dst(i0, i1, i2, i3, i4, i5) = value;
     });
     team.team_barrier();
@@ -794,19 +993,19 @@ void KOKKOS_INLINE_FUNCTION local_deep_copy(
     team.team_barrier();
   } else {
     team.team_barrier();
-    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const int &i) {
-      int i0                          = i % dst.extent(0);
-      int itmp                        = i / dst.extent(0);
-      int i1                          = itmp % dst.extent(1);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, N), [&](const size_t i) {
+      size_t i0                       = i % dst.extent(0);
+      size_t itmp                     = i / dst.extent(0);
+      size_t i1                       = itmp % dst.extent(1);
       itmp                            = itmp / dst.extent(1);
-      int i2                          = itmp % dst.extent(2);
+      size_t i2                       = itmp % dst.extent(2);
       itmp                            = itmp / dst.extent(2);
-      int i3                          = itmp % dst.extent(3);
+      size_t i3                       = itmp % dst.extent(3);
       itmp                            = itmp / dst.extent(3);
-      int i4                          = itmp % dst.extent(4);
+      size_t i4                       = itmp % dst.extent(4);
       itmp                            = itmp / dst.extent(4);
-      int i5                          = itmp % dst.extent(5);
-      int i6                          = itmp / dst.extent(5);
+      size_t i5                       = itmp % dst.extent(5);
+      size_t i6                       = itmp / dst.extent(5);
       dst(i0, i1, i2, i3, i4, i5, i6) = value;
     });
     team.team_barrier();
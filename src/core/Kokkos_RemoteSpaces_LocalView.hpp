@@ -0,0 +1,164 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_LOCALVIEW_HPP
+#define KOKKOS_REMOTESPACES_LOCALVIEW_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+
+namespace Kokkos {
+namespace Impl {
+
+// Layout of the partition of a remote view owned by the calling PE
+template <class Layout>
+struct RemoteSpaces_LocalLayout {
+  using type = Layout;
+};
+
+template <>
+struct RemoteSpaces_LocalLayout<Kokkos::PartitionedLayoutLeft> {
+  using type = Kokkos::LayoutLeft;
+};
+
+template <>
+struct RemoteSpaces_LocalLayout<Kokkos::PartitionedLayoutRight> {
+  using type = Kokkos::LayoutRight;
+};
+
+template <>
+struct RemoteSpaces_LocalLayout<Kokkos::PartitionedLayoutStride> {
+  using type = Kokkos::LayoutStride;
+};
+
+template <size_t B>
+struct RemoteSpaces_LocalLayout<Kokkos::BlockCyclicLayout<B>> {
+  using type = Kokkos::LayoutRight;
+};
+
+template <>
+struct RemoteSpaces_LocalLayout<Kokkos::IrregularLayout> {
+  using type = Kokkos::LayoutRight;
+};
+
+template <size_t W>
+struct RemoteSpaces_LocalLayout<Kokkos::HaloLayout<W>> {
+  using type = Kokkos::LayoutRight;
+};
+
+template <unsigned Dim>
+struct RemoteSpaces_LocalLayout<Kokkos::DistributedLayoutLeft<Dim>> {
+  using type = Kokkos::LayoutLeft;
+};
+
+template <class Layout>
+struct is_partitioned_layout
+    : std::integral_constant<
+          bool,
+          std::is_same<Layout, Kokkos::PartitionedLayoutLeft>::value ||
+              std::is_same<Layout, Kokkos::PartitionedLayoutRight>::value ||
+              std::is_same<Layout, Kokkos::PartitionedLayoutStride>::value> {};
+
+template <class Layout, class ViewType>
+void set_local_strides(Layout &, const ViewType &) {}
+
+template <class ViewType>
+void set_local_strides(Kokkos::LayoutStride &layout, const ViewType &v) {
+  for (unsigned r = 0; r < ViewType::rank; ++r) layout.stride[r] = v.stride(r);
+}
+
+template <class ViewType>
+struct RemoteSpaces_LocalView {
+  using traits          = typename ViewType::traits;
+  using execution_space = typename traits::execution_space;
+  using type            = Kokkos::View<
+      typename traits::data_type,
+      typename RemoteSpaces_LocalLayout<typename traits::array_layout>::type,
+      Kokkos::Device<execution_space, typename execution_space::memory_space>>;
+};
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Returns a view of the elements of v owned by the calling PE. The
+ * view shares the allocation of v and accesses memory directly. The leading
+ * dimension of partitioned views has extent one. The local view of a halo
+ * view includes the ghost rows, so owned rows start at the halo width.
+ */
+template <class RT, class... RP>
+typename Kokkos::Impl::RemoteSpaces_LocalView<View<RT, RP...>>::type
+get_local_view(const View<RT, RP...> &v) {
+  using remote_traits = typename View<RT, RP...>::traits;
+  static_assert(std::is_same<typename remote_traits::specialize,
+                             RemoteSpaceSpecializeTag>::value,
+                "get_local_view requires a remote view.");
+
+  using local_view_type =
+      typename Kokkos::Impl::RemoteSpaces_LocalView<View<RT, RP...>>::type;
+  using local_traits = typename local_view_type::traits;
+  using local_layout = typename local_traits::array_layout;
+  using map_type =
+      Kokkos::Impl::ViewMapping<local_traits,
+                                typename local_traits::specialize>;
+
+  local_layout layout;
+  for (unsigned r = 0; r < local_traits::rank; ++r)
+    layout.dimension[r] = v.extent(r);
+  if (Kokkos::Impl::is_partitioned_layout<
+          typename remote_traits::array_layout>::value &&
+      local_traits::rank > 0)
+    layout.dimension[0] = 1;
+  if (local_traits::rank > 0)
+    layout.dimension[0] += 2 * Kokkos::Impl::halo_width<
+                                   typename remote_traits::array_layout>::value;
+  Kokkos::Impl::set_local_strides(layout, v);
+
+  map_type map(Kokkos::view_wrap(v.data()), layout);
+  return local_view_type(v.impl_track().m_tracker, map);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_LOCALVIEW_HPP
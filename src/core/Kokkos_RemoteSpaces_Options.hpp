@@ -52,7 +52,13 @@ namespace Kokkos {
 
 enum RemoteSpaces_MemoryTraitsFlags {
   /*GlobalIndex = 1 < 0x128,*/
-  Dim0IsPE = 1 < 0x192
+  Dim0IsPE = 1 < 0x192,
+  // Remote stores return before completion. Completion is deferred to the
+  // next fence of the remote memory space.
+  NonBlocking = 0x200,
+  // Global views round their per-PE block up to a power of two so that
+  // index translation reduces to a shift and a mask
+  PowerOfTwoBlocks = 0x400
 };
 
 template <typename T>
@@ -61,6 +67,12 @@ struct RemoteSpaces_MemoryTraits;
 template <unsigned T>
 struct RemoteSpaces_MemoryTraits<MemoryTraits<T>> {
   enum : bool { dim0_is_pe = (unsigned(0) != (T & unsigned(Dim0IsPE))) };
+  enum : bool {
+    is_nonblocking = (unsigned(0) != (T & unsigned(NonBlocking)))
+  };
+  enum : bool {
+    is_power_of_two_blocks = (unsigned(0) != (T & unsigned(PowerOfTwoBlocks)))
+  };
 
   enum : int { state = T };
 };
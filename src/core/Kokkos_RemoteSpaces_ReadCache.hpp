@@ -0,0 +1,220 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_READCACHE_HPP
+#define KOKKOS_REMOTESPACES_READCACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+// Geometry of the read cache of allocations in the Cached allocation mode,
+// taken from the environment variables KOKKOS_REMOTE_SPACES_CACHE_LINE_SIZE
+// and KOKKOS_REMOTE_SPACES_CACHE_SIZE (in bytes)
+inline size_t get_read_cache_env(const char *name, size_t fallback) {
+  const char *env    = std::getenv(name);
+  const size_t value = env ? std::strtoull(env, nullptr, 10) : 0;
+  return value ? value : fallback;
+}
+
+// Host-side set-associative cache of remote data. Lines are identified by
+// the allocation, the PE and the line index within the allocation, so a
+// line never spans two allocations. A miss fetches the whole line with one
+// bulk get. The cache does not track remote writes: it is emptied by the
+// fence of the memory space, and local writes through a view drop the
+// lines they touch. Every set has its own lock, so reads of different sets
+// do not contend.
+class RemoteReadCache {
+ public:
+  static constexpr size_t ways = 4;
+
+  RemoteReadCache()
+      : line_size(get_read_cache_env("KOKKOS_REMOTE_SPACES_CACHE_LINE_SIZE",
+                                     256)),
+        num_sets(std::max<size_t>(
+            1, get_read_cache_env("KOKKOS_REMOTE_SPACES_CACHE_SIZE",
+                                  size_t(1) << 20) /
+                   (line_size * ways))),
+        set_locks(new std::mutex[num_sets]) {}
+
+  // Copies n bytes at byte offset pos of the allocation owner on pe to dst.
+  // The allocation holds size bytes. fill(dst, pos, n) gets n bytes at pos
+  // from pe and completes before returning
+  template <class Fill>
+  void read(void *dst, const void *owner, int pe, size_t pos, size_t n,
+            size_t size, const Fill &fill) {
+    char *out = static_cast<char *>(dst);
+    // Storage is reserved by the first read
+    std::call_once(storage_once, [this]() {
+      tags.resize(num_sets * ways);
+      data.resize(num_sets * ways * line_size);
+      ready.store(true, std::memory_order_release);
+    });
+    while (n) {
+      const size_t line  = pos / line_size;
+      const size_t begin = pos - line * line_size;
+      const size_t count = std::min(n, line_size - begin);
+      const size_t set   = set_of(owner, pe, line);
+      std::lock_guard<std::mutex> lock(set_locks[set]);
+      const char *cached = lookup(set, owner, pe, line, size, fill);
+      std::memcpy(out, cached + begin, count);
+      out += count;
+      pos += count;
+      n -= count;
+    }
+  }
+
+  // Drops the lines holding n bytes at byte offset pos of owner on pe
+  void forget(const void *owner, int pe, size_t pos, size_t n) {
+    if (!ready.load(std::memory_order_acquire)) return;
+    for (size_t line = pos / line_size; line * line_size < pos + n; ++line) {
+      const size_t set = set_of(owner, pe, line);
+      std::lock_guard<std::mutex> lock(set_locks[set]);
+      Tag *tag = &tags[set * ways];
+      for (size_t w = 0; w < ways; ++w)
+        if (tag[w].matches(owner, pe, line)) tag[w].owner = nullptr;
+    }
+  }
+
+  // Drops all lines of owner
+  void forget(const void *owner) {
+    if (!ready.load(std::memory_order_acquire)) return;
+    for (size_t set = 0; set < num_sets; ++set) {
+      std::lock_guard<std::mutex> lock(set_locks[set]);
+      Tag *tag = &tags[set * ways];
+      for (size_t w = 0; w < ways; ++w)
+        if (tag[w].owner == owner) tag[w].owner = nullptr;
+    }
+  }
+
+  void invalidate() {
+    if (!ready.load(std::memory_order_acquire)) return;
+    for (size_t set = 0; set < num_sets; ++set) {
+      std::lock_guard<std::mutex> lock(set_locks[set]);
+      Tag *tag = &tags[set * ways];
+      for (size_t w = 0; w < ways; ++w) tag[w].owner = nullptr;
+    }
+  }
+
+  size_t get_hits() const { return hits.load(std::memory_order_relaxed); }
+  size_t get_misses() const { return misses.load(std::memory_order_relaxed); }
+
+ private:
+  struct Tag {
+    const void *owner = nullptr;
+    int pe            = 0;
+    size_t line       = 0;
+    uint64_t last_use = 0;
+
+    bool matches(const void *owner_, int pe_, size_t line_) const {
+      return owner == owner_ && pe == pe_ && line == line_;
+    }
+  };
+
+  size_t set_of(const void *owner, int pe, size_t line) const {
+    uint64_t key = reinterpret_cast<uintptr_t>(owner);
+    key ^= (uint64_t(pe) << 40) ^ line;
+    key *= 0x9E3779B97F4A7C15ull;
+    return (key >> 32) % num_sets;
+  }
+
+  // Requires the lock of set
+  template <class Fill>
+  const char *lookup(size_t set, const void *owner, int pe, size_t line,
+                     size_t size, const Fill &fill) {
+    Tag *tag      = &tags[set * ways];
+    size_t victim = 0;
+    for (size_t w = 0; w < ways; ++w) {
+      if (tag[w].matches(owner, pe, line)) {
+        tag[w].last_use = tick();
+        hits.fetch_add(1, std::memory_order_relaxed);
+        return &data[(set * ways + w) * line_size];
+      }
+      // Prefer empty ways, then the least recently used one
+      if (!tag[victim].owner) continue;
+      if (!tag[w].owner || tag[w].last_use < tag[victim].last_use) victim = w;
+    }
+    misses.fetch_add(1, std::memory_order_relaxed);
+    char *dst          = &data[(set * ways + victim) * line_size];
+    const size_t begin = line * line_size;
+    fill(dst, begin, std::min(line_size, size - begin));
+    tag[victim].owner    = owner;
+    tag[victim].pe       = pe;
+    tag[victim].line     = line;
+    tag[victim].last_use = tick();
+    return dst;
+  }
+
+  uint64_t tick() { return clock.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+  const size_t line_size;
+  const size_t num_sets;
+  std::unique_ptr<std::mutex[]> set_locks;
+  std::once_flag storage_once;
+  std::atomic<bool> ready{false};
+  std::vector<Tag> tags;
+  std::vector<char> data;
+  std::atomic<uint64_t> clock{0};
+  std::atomic<size_t> hits{0};
+  std::atomic<size_t> misses{0};
+};
+
+// Read cache shared by all allocations of the process
+inline RemoteReadCache &get_read_cache() {
+  static RemoteReadCache cache;
+  return cache;
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_READCACHE_HPP
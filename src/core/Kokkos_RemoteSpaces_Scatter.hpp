@@ -0,0 +1,231 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_SCATTER_HPP
+#define KOKKOS_REMOTESPACES_SCATTER_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+// Reduction operators of RemoteScatterView
+
+struct ScatterSum {
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static T identity() {
+    return Kokkos::reduction_identity<T>::sum();
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void join(T &dst, const T &src) {
+    dst += src;
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void atomic_join(T *dst, const T &src) {
+    Kokkos::atomic_add(dst, src);
+  }
+};
+
+struct ScatterMin {
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static T identity() {
+    return Kokkos::reduction_identity<T>::min();
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void join(T &dst, const T &src) {
+    if (src < dst) dst = src;
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void atomic_join(T *dst, const T &src) {
+    Kokkos::atomic_fetch_min(dst, src);
+  }
+};
+
+struct ScatterMax {
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static T identity() {
+    return Kokkos::reduction_identity<T>::max();
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void join(T &dst, const T &src) {
+    if (src > dst) dst = src;
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void atomic_join(T *dst, const T &src) {
+    Kokkos::atomic_fetch_max(dst, src);
+  }
+};
+
+struct ScatterBitXor {
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static T identity() {
+    return T(0);
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void join(T &dst, const T &src) {
+    dst ^= src;
+  }
+  template <class T>
+  KOKKOS_INLINE_FUNCTION static void atomic_join(T *dst, const T &src) {
+    Kokkos::atomic_fetch_xor(dst, src);
+  }
+};
+
+/** \brief  Accumulates updates to a global 1D remote view locally.
+ *
+ * update(i, x) combines x into a local buffer holding one slot per element
+ * of the global view, so repeated updates of an index cost one local atomic
+ * each. contribute() is collective. Every PE puts the slots of each target
+ * PE into a staging partition on that PE with one bulk transfer, and the
+ * target reduces the staging partition into its share. The buffer is reset
+ * to the identity of Op afterwards. The buffer spans the global view, so
+ * this pays off when updates are dense or repeat often.
+ */
+template <class ViewType, class Op = ScatterSum>
+class RemoteScatterView {
+  using traits = typename ViewType::traits;
+  using layout = typename traits::array_layout;
+
+  static_assert(unsigned(traits::rank) == 1,
+                "RemoteScatterView requires a view of rank 1.");
+  static_assert(!std::is_const<typename traits::value_type>::value,
+                "RemoteScatterView requires a non-const view.");
+  static_assert(
+      std::is_same<layout, Kokkos::LayoutRight>::value ||
+          std::is_same<layout, Kokkos::LayoutLeft>::value ||
+          (Kokkos::Impl::is_right_global_layout<layout>::value &&
+           !Kokkos::Impl::is_irregular_layout<layout>::value),
+      "RemoteScatterView requires a global layout with equal shares.");
+
+ public:
+  using value_type          = typename traits::non_const_value_type;
+  using execution_space     = typename traits::execution_space;
+  using remote_memory_space = typename traits::memory_space;
+  using buffer_type =
+      Kokkos::View<value_type *, typename execution_space::memory_space>;
+  using staging_type =
+      Kokkos::View<value_type **, Kokkos::PartitionedLayoutRight,
+                   remote_memory_space>;
+
+  RemoteScatterView() = default;
+
+  RemoteScatterView(const ViewType &v)
+      : m_view(v),
+        m_share(Kokkos::Experimental::get_local_view(v).span()),
+        m_num_pes(v.impl_map().impl_num_pes()) {
+    m_buffer = buffer_type(
+        Kokkos::ViewAllocateWithoutInitializing("RemoteScatterView::buffer"),
+        m_num_pes * m_share);
+    // The staging partitions live on the PEs sharing the view
+    m_staging = staging_type(
+        Kokkos::view_alloc("RemoteScatterView::staging",
+                           Kokkos::Experimental::get_memory_space(v)),
+        m_num_pes, m_share);
+    reset();
+  }
+
+  /** \brief  Combines x into element i of the global view */
+  KOKKOS_INLINE_FUNCTION
+  void update(const size_t i, const value_type &x) const {
+    const auto &map = m_view.impl_map();
+    const auto owner =
+        map.compute_dim0_offsets(map.impl_offset_remote_dim() + i);
+    Op::atomic_join(&m_buffer(owner.pe * m_share + owner.offset), x);
+  }
+
+  /** \brief  Sets all buffered slots to the identity of Op */
+  void reset() const {
+    Kokkos::deep_copy(m_buffer, Op::template identity<value_type>());
+  }
+
+  /** \brief  Applies the buffered updates of all PEs to the view. Collective
+   * over the PEs of the view */
+  void contribute() const {
+    const int pe          = m_view.impl_map().impl_my_pe();
+    const size_t share    = m_share;
+    value_type *const dst = m_view.data();
+    const auto &handle    = m_staging.impl_map().handle();
+    auto space            = Kokkos::Experimental::get_memory_space(m_view);
+
+    // Own slots need no transfer
+    reduce_into(dst, m_buffer.data() + pe * share);
+
+    for (int round = 1; round < m_num_pes; ++round) {
+      const int target = (pe + round) % m_num_pes;
+      Kokkos::fence();
+      Kokkos::Impl::put_nbi(handle, 0, m_buffer.data() + target * share, share,
+                            target);
+      space.fence();
+      reduce_into(dst, m_staging.data());
+      // The staging partition is reused in the next round
+      Kokkos::fence();
+      space.fence();
+    }
+    Kokkos::fence();
+    reset();
+  }
+
+  const ViewType &view() const { return m_view; }
+
+ private:
+  void reduce_into(value_type *dst, const value_type *src) const {
+    Kokkos::parallel_for(
+        "RemoteScatterView::contribute",
+        Kokkos::RangePolicy<execution_space>(0, m_share),
+        KOKKOS_LAMBDA(const size_t i) { Op::join(dst[i], src[i]); });
+  }
+
+  ViewType m_view;
+  buffer_type m_buffer;
+  staging_type m_staging;
+  size_t m_share = 0;
+  int m_num_pes  = 0;
+};
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_SCATTER_HPP
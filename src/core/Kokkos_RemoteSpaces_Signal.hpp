@@ -0,0 +1,108 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_SIGNAL_HPP
+#define KOKKOS_REMOTESPACES_SIGNAL_HPP
+
+#include <Kokkos_RemoteSpaces.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+namespace RemoteSpaces {
+
+/** \brief  Copies the contiguous data of src to the contiguous memory
+ * referenced by dst on pe and then sets the signal referenced by sig on pe to
+ * value. The signal is observed only after the data has arrived. dst and sig
+ * reference the same location on every PE, e.g. subviews with an
+ * unrestricted dim0.
+ */
+template <class DT, class... DP, class ST, class... SP, class GT, class... GP>
+void put_signal(const View<DT, DP...> &dst, const View<ST, SP...> &src,
+                const View<GT, GP...> &sig, uint64_t value, int pe) {
+  static_assert(
+      std::is_same<typename ViewTraits<DT, DP...>::specialize,
+                   Kokkos::Experimental::RemoteSpaceSpecializeTag>::value &&
+          std::is_same<typename ViewTraits<GT, GP...>::specialize,
+                       Kokkos::Experimental::RemoteSpaceSpecializeTag>::value,
+      "put_signal requires remote destination and signal views.");
+  static_assert(
+      std::is_same<typename ViewTraits<GT, GP...>::value_type, uint64_t>::value,
+      "put_signal requires a uint64_t signal view.");
+  static_assert(
+      std::is_same<typename ViewTraits<DT, DP...>::non_const_value_type,
+                   typename ViewTraits<ST, SP...>::non_const_value_type>::value,
+      "put_signal requires matching value types.");
+
+  if (!src.span_is_contiguous())
+    Kokkos::abort("put_signal requires a contiguous source view.");
+  if (!dst.span_is_contiguous())
+    Kokkos::abort("put_signal requires a contiguous destination view.");
+  if (src.span() > dst.span())
+    Kokkos::abort("put_signal requires a destination view at least as large "
+                  "as the source view.");
+
+  Kokkos::Impl::put_signal(dst.impl_map().handle(), src.data(), src.span(),
+                           sig.impl_map().handle(), value, pe);
+}
+
+/** \brief  Waits until the local signal referenced by sig is at least value.
+ */
+template <class GT, class... GP>
+void wait_until(const View<GT, GP...> &sig, uint64_t value) {
+  static_assert(
+      std::is_same<typename ViewTraits<GT, GP...>::specialize,
+                   Kokkos::Experimental::RemoteSpaceSpecializeTag>::value,
+      "wait_until requires a remote signal view.");
+  static_assert(
+      std::is_same<typename ViewTraits<GT, GP...>::value_type, uint64_t>::value,
+      "wait_until requires a uint64_t signal view.");
+
+  Kokkos::Impl::signal_wait_until(sig.impl_map().handle(), value);
+}
+
+}  // namespace RemoteSpaces
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_SIGNAL_HPP
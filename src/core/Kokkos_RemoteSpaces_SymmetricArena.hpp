@@ -0,0 +1,140 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOS_REMOTESPACES_SYMMETRICARENA_HPP
+#define KOKKOS_REMOTESPACES_SYMMETRICARENA_HPP
+
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace Kokkos {
+namespace Impl {
+
+// Size in bytes of the symmetric arena serving remote allocations, taken from
+// the environment variable KOKKOS_REMOTE_SPACES_ARENA_SIZE (0: arena disabled)
+inline size_t get_symmetric_arena_size() {
+  const char *env = std::getenv("KOKKOS_REMOTE_SPACES_ARENA_SIZE");
+  return env ? std::strtoull(env, nullptr, 10) : 0;
+}
+
+// First-fit allocator over a symmetric segment. The allocator is
+// deterministic: PEs issuing the same sequence of allocations and
+// deallocations obtain the same offsets without communicating.
+class SymmetricArena {
+ public:
+  SymmetricArena(void *base_, size_t capacity_, size_t alignment_ = 64)
+      : base(static_cast<char *>(base_)),
+        capacity(capacity_),
+        alignment(alignment_) {
+    free_blocks[0] = capacity;
+  }
+
+  // Returns nullptr if no free block is large enough
+  void *allocate(size_t size) {
+    size = (size + alignment - 1) / alignment * alignment;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it) {
+      if (it->second < size) continue;
+      const size_t offset = it->first;
+      const size_t remain = it->second - size;
+      free_blocks.erase(it);
+      if (remain) free_blocks[offset + size] = remain;
+      used_blocks[offset] = size;
+      return base + offset;
+    }
+    return nullptr;
+  }
+
+  // Returns false if ptr was not allocated from the arena
+  bool deallocate(void *ptr) {
+    if (!contains(ptr)) return false;
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t offset = static_cast<char *>(ptr) - base;
+    auto used     = used_blocks.find(offset);
+    if (used == used_blocks.end()) return false;
+    size_t size = used->second;
+    used_blocks.erase(used);
+
+    // Coalesce with the neighboring free blocks
+    auto next = free_blocks.lower_bound(offset);
+    if (next != free_blocks.end() && next->first == offset + size) {
+      size += next->second;
+      next = free_blocks.erase(next);
+    }
+    if (next != free_blocks.begin()) {
+      auto prev = std::prev(next);
+      if (prev->first + prev->second == offset) {
+        prev->second += size;
+        return true;
+      }
+    }
+    free_blocks[offset] = size;
+    return true;
+  }
+
+  bool contains(const void *ptr) const {
+    const char *p = static_cast<const char *>(ptr);
+    return p >= base && p < base + capacity;
+  }
+
+  char *get_base() const { return base; }
+  size_t get_capacity() const { return capacity; }
+
+ private:
+  char *base;
+  size_t capacity;
+  size_t alignment;
+  std::mutex mutex;
+  // Offset to size of the free and allocated blocks
+  std::map<size_t, size_t> free_blocks;
+  std::unordered_map<size_t, size_t> used_blocks;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // KOKKOS_REMOTESPACES_SYMMETRICARENA_HPP
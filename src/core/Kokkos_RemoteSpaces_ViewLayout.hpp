@@ -153,8 +153,175 @@ struct PartitionedLayoutStride {
                                                           S4, S5, S6, S7} {}
 };
 
+// Global layout distributing dim0 round-robin over the PEs in blocks of B
+// indices. Each PE stores its blocks contiguously in LayoutRight order
+template <size_t B>
+struct BlockCyclicLayout {
+  static_assert(B > 0, "BlockCyclicLayout requires a non-zero block size");
+
+  //! Tag this class as a kokkos array layout
+  using array_layout = BlockCyclicLayout<B>;
+
+  enum : size_t { block_size = B };
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  BlockCyclicLayout(BlockCyclicLayout const &) = default;
+  BlockCyclicLayout(BlockCyclicLayout &&)      = default;
+  BlockCyclicLayout &operator=(BlockCyclicLayout const &) = default;
+  BlockCyclicLayout &operator=(BlockCyclicLayout &&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr BlockCyclicLayout(size_t N0 = 0, size_t N1 = 0,
+                                       size_t N2 = 0, size_t N3 = 0,
+                                       size_t N4 = 0, size_t N5 = 0,
+                                       size_t N6 = 0, size_t N7 = 0)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+};
+
+// Global layout distributing dim0 round-robin over the PEs
+using CyclicLayout = BlockCyclicLayout<1>;
+
+// Global layout distributing dim0 following a partition table. PE p owns
+// the indices [pe_offsets[p], pe_offsets[p + 1]) and stores them in
+// LayoutRight order. The table is read on the host at view construction
+// and holds num_pes + 1 entries
+struct IrregularLayout {
+  //! Tag this class as a kokkos array layout
+  using array_layout = IrregularLayout;
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  const size_t *pe_offsets;
+
+  enum : bool { is_extent_constructible = false };
+
+  IrregularLayout(IrregularLayout const &) = default;
+  IrregularLayout(IrregularLayout &&)      = default;
+  IrregularLayout &operator=(IrregularLayout const &) = default;
+  IrregularLayout &operator=(IrregularLayout &&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr IrregularLayout(const size_t *offsets = nullptr,
+                                     size_t N1 = 0, size_t N2 = 0,
+                                     size_t N3 = 0, size_t N4 = 0,
+                                     size_t N5 = 0, size_t N6 = 0,
+                                     size_t N7 = 0)
+      : dimension{0, N1, N2, N3, N4, N5, N6, N7}, pe_offsets(offsets) {}
+};
+
+// Global layout distributing dimension Dim instead of dim0. Each PE stores
+// its share in LayoutLeft order, so distributing the last dimension keeps
+// every share contiguous
+template <unsigned Dim>
+struct DistributedLayoutLeft {
+  //! Tag this class as a kokkos array layout
+  using array_layout = DistributedLayoutLeft<Dim>;
+
+  enum : unsigned { distributed_dim = Dim };
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  DistributedLayoutLeft(DistributedLayoutLeft const &) = default;
+  DistributedLayoutLeft(DistributedLayoutLeft &&)      = default;
+  DistributedLayoutLeft &operator=(DistributedLayoutLeft const &) = default;
+  DistributedLayoutLeft &operator=(DistributedLayoutLeft &&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr DistributedLayoutLeft(size_t N0 = 0, size_t N1 = 0,
+                                           size_t N2 = 0, size_t N3 = 0,
+                                           size_t N4 = 0, size_t N5 = 0,
+                                           size_t N6 = 0, size_t N7 = 0)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+};
+
+// Global layout distributing dim0 like LayoutRight with W ghost rows on
+// either side of the share of every PE. Ghost rows hold copies of the
+// neighboring shares and are refreshed by exchange_halos
+template <size_t W>
+struct HaloLayout {
+  //! Tag this class as a kokkos array layout
+  using array_layout = HaloLayout<W>;
+
+  enum : size_t { halo_width = W };
+
+  size_t dimension[ARRAY_LAYOUT_MAX_RANK];
+
+  enum : bool { is_extent_constructible = true };
+
+  HaloLayout(HaloLayout const &) = default;
+  HaloLayout(HaloLayout &&)      = default;
+  HaloLayout &operator=(HaloLayout const &) = default;
+  HaloLayout &operator=(HaloLayout &&) = default;
+
+  KOKKOS_INLINE_FUNCTION
+  explicit constexpr HaloLayout(size_t N0 = 0, size_t N1 = 0, size_t N2 = 0,
+                                size_t N3 = 0, size_t N4 = 0, size_t N5 = 0,
+                                size_t N6 = 0, size_t N7 = 0)
+      : dimension{N0, N1, N2, N3, N4, N5, N6, N7} {}
+};
+
 namespace Impl {
 
+template <class Layout>
+struct is_halo_layout : std::false_type {};
+
+template <size_t W>
+struct is_halo_layout<Kokkos::HaloLayout<W>> : std::true_type {};
+
+// Ghost rows on either side of the share of a PE, 0 for any other layout
+template <class Layout>
+struct halo_width : std::integral_constant<size_t, 0> {};
+
+template <size_t W>
+struct halo_width<Kokkos::HaloLayout<W>> : std::integral_constant<size_t, W> {
+};
+
+template <class Layout>
+struct is_distributed_layout_left : std::false_type {};
+
+template <unsigned Dim>
+struct is_distributed_layout_left<Kokkos::DistributedLayoutLeft<Dim>>
+    : std::true_type {};
+
+// Dimension split over the PEs by a global layout
+template <class Layout>
+struct distributed_dim : std::integral_constant<unsigned, 0> {};
+
+template <unsigned Dim>
+struct distributed_dim<Kokkos::DistributedLayoutLeft<Dim>>
+    : std::integral_constant<unsigned, Dim> {};
+
+template <class Layout>
+struct is_block_cyclic_layout : std::false_type {};
+
+template <size_t B>
+struct is_block_cyclic_layout<Kokkos::BlockCyclicLayout<B>> : std::true_type {
+};
+
+// Block size of a block-cyclic layout, 1 for any other layout
+template <class Layout>
+struct block_cyclic_size : std::integral_constant<size_t, 1> {};
+
+template <size_t B>
+struct block_cyclic_size<Kokkos::BlockCyclicLayout<B>>
+    : std::integral_constant<size_t, B> {};
+
+template <class Layout>
+struct is_irregular_layout
+    : std::is_same<Layout, Kokkos::IrregularLayout>::type {};
+
+// Global layouts whose PEs store their share of dim0 in LayoutRight order
+template <class Layout>
+struct is_right_global_layout
+    : std::integral_constant<bool, is_block_cyclic_layout<Layout>::value ||
+                                       is_irregular_layout<Layout>::value ||
+                                       is_halo_layout<Layout>::value> {};
+
 // Rules for subview arguments and global layouts matching
 // Rules which allow LayoutLeft to LayoutLeft assignment
 
@@ -270,6 +437,50 @@ struct SubviewLegalArgsCompileTime<Kokkos::LayoutLeft,
   enum : bool { value = false };
 };
 
+// Block-cyclic layouts follow the rules of LayoutRight. Subviews that would
+// require a strided layout are rejected by the subview mapping
+
+template <size_t B, int RankDest, int RankSrc, int CurrentArg,
+          class... SubViewArgs>
+struct SubviewLegalArgsCompileTime<Kokkos::BlockCyclicLayout<B>,
+                                   Kokkos::BlockCyclicLayout<B>, RankDest,
+                                   RankSrc, CurrentArg, SubViewArgs...>
+    : SubviewLegalArgsCompileTime<Kokkos::LayoutRight, Kokkos::LayoutRight,
+                                  RankDest, RankSrc, CurrentArg,
+                                  SubViewArgs...> {};
+
+// Layouts distributed along a chosen dimension follow the rules of LayoutLeft
+
+template <unsigned Dim, int RankDest, int RankSrc, int CurrentArg,
+          class... SubViewArgs>
+struct SubviewLegalArgsCompileTime<Kokkos::DistributedLayoutLeft<Dim>,
+                                   Kokkos::DistributedLayoutLeft<Dim>, RankDest,
+                                   RankSrc, CurrentArg, SubViewArgs...>
+    : SubviewLegalArgsCompileTime<Kokkos::LayoutLeft, Kokkos::LayoutLeft,
+                                  RankDest, RankSrc, CurrentArg,
+                                  SubViewArgs...> {};
+
+// Halo layouts follow the rules of LayoutRight
+
+template <size_t W, int RankDest, int RankSrc, int CurrentArg,
+          class... SubViewArgs>
+struct SubviewLegalArgsCompileTime<Kokkos::HaloLayout<W>,
+                                   Kokkos::HaloLayout<W>, RankDest, RankSrc,
+                                   CurrentArg, SubViewArgs...>
+    : SubviewLegalArgsCompileTime<Kokkos::LayoutRight, Kokkos::LayoutRight,
+                                  RankDest, RankSrc, CurrentArg,
+                                  SubViewArgs...> {};
+
+// Irregular layouts follow the rules of LayoutRight as well
+
+template <int RankDest, int RankSrc, int CurrentArg, class... SubViewArgs>
+struct SubviewLegalArgsCompileTime<Kokkos::IrregularLayout,
+                                   Kokkos::IrregularLayout, RankDest, RankSrc,
+                                   CurrentArg, SubViewArgs...>
+    : SubviewLegalArgsCompileTime<Kokkos::LayoutRight, Kokkos::LayoutRight,
+                                  RankDest, RankSrc, CurrentArg,
+                                  SubViewArgs...> {};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
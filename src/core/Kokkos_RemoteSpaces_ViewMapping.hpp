@@ -46,6 +46,7 @@
 #define KOKKOS_REMOTESPACES_VIEWMAPPING_HPP
 
 #include <type_traits>
+#include <utility>
 
 //----------------------------------------------------------------------------
 /** \brief  View mapping for non-specialized data type and standard layout */
@@ -126,6 +127,33 @@ std::pair<size_t, size_t> get_local_range(
   return getRange(size, pe);
 }
 
+// Ranges over the PEs of the memory space instance space
+template <typename T, typename Space>
+std::pair<size_t, size_t> get_range(
+    T size, size_t pe, const Space &space,
+    typename std::enable_if<std::is_integral<T>::value>::type * = nullptr) {
+  return getRange(size, pe, space);
+}
+
+template <typename T, typename Space>
+std::pair<size_t, size_t> get_local_range(
+    T size, const Space &space,
+    typename std::enable_if<std::is_integral<T>::value>::type * = nullptr) {
+  return getRange(size, get_my_pe(space), space);
+}
+
+// The memory space instance whose PEs share the allocation of view v.
+// Collective operations on v fence this instance
+template <class ViewType>
+typename ViewType::memory_space get_memory_space(const ViewType &v) {
+#if defined(KOKKOS_ENABLE_MPISPACE)
+  return typename ViewType::memory_space(MPISpace::get_comm(v.data()));
+#else
+  (void)v;
+  return typename ViewType::memory_space();
+#endif
+}
+
 }  // namespace Experimental
 
 namespace Impl {
@@ -227,6 +255,21 @@ class ViewMapping<
                         Kokkos::PartitionedLayoutStride>::value),
       Kokkos::PartitionedLayoutStride, array_layout_candidate>::type;
 
+  // Indexing of block-cyclic, irregular and halo views relies on dim0 and
+  // the local LayoutRight storage of the source view
+  static_assert(
+      !is_right_global_layout<typename SrcTraits::array_layout>::value ||
+          (R0 && std::is_same<array_layout,
+                              typename SrcTraits::array_layout>::value),
+      "Subviews of block-cyclic, irregular and halo views must preserve "
+      "the layout");
+
+  // Indexing relies on the distributed dimension keeping its position
+  static_assert(
+      !is_distributed_layout_left<typename SrcTraits::array_layout>::value,
+      "Subviews of views distributed along a chosen dimension are not "
+      "supported");
+
   using value_type = typename SrcTraits::value_type;
 
   using data_type =
@@ -296,11 +339,17 @@ class ViewMapping<
 
     dst.m_offset     = dst_offset_type(src.m_offset, extents);
     dst.m_local_dim0 = src.m_local_dim0;
+    dst.m_dim0_shift = src.m_dim0_shift;
+    dst.m_dim0_mask  = src.m_dim0_mask;
+    dst.m_pe_offsets = src.m_pe_offsets;
+    dst.m_num_pes    = src.m_num_pes;
+    dst.pe           = src.pe;
 
     // Set offset for dim0 manually in order to support remote copy-ctr'ed views
     // and subviews
     dst.m_offset_remote_dim = extents.domain_offset(0);
     dst.dim0_is_pe          = R0;
+    dst.m_is_subview        = true;
 
     dst.m_handle = ViewDataHandle<DstTraits>::assign(
         src.m_handle,
@@ -311,6 +360,9 @@ class ViewMapping<
   }
 };
 
+// Placeholder for the partition table of layouts that do not need one
+struct NoPartitionTable {};
+
 /*
  * ViewMapping class used by View specialization
  */
@@ -341,15 +393,38 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   size_t m_offset_remote_dim;
   size_t m_local_dim0;
 
+  // Shift and mask replacing the division by m_local_dim0 of global views.
+  // The shift is negative if m_local_dim0 is not a power of two
+  int m_dim0_shift;
+  size_t m_dim0_mask;
+
+  // First global index of dim0 owned by each PE, plus the global extent.
+  // Only irregular layouts carry a table
+  using pe_offsets_type = typename std::conditional<
+      is_irregular_layout<layout>::value,
+      Kokkos::View<size_t *,
+                   typename Traits::execution_space::memory_space>,
+      NoPartitionTable>::type;
+  pe_offsets_type m_pe_offsets;
+
   // We need this dynamic property as we do not derive the
   // type specialization at view construction through the
   // subview ctr. Default is set to 1 as a direct view construction
   // with a partitioned layout always expects dim0 to be rank id
   size_t dim0_is_pe;
 
+  // Set for subviews, whose dim0 indices start at m_offset_remote_dim.
+  // Other views of global layouts address the share of the calling PE in
+  // local deep copies
+  bool m_is_subview;
+
   int m_num_pes;
   int pe;
 
+  static_assert(!is_distributed_layout_left<layout>::value ||
+                    distributed_dim<layout>::value < unsigned(Traits::rank),
+                "The distributed dimension must be smaller than the rank");
+
  public:
   typedef void printable_label_typedef;
   enum { is_managed = Traits::is_managed };
@@ -376,11 +451,19 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
       typename std::enable_if<
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
-          std::is_same<typename T::array_layout,
-                       Kokkos::LayoutStride>::value>::type * = nullptr) const {
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value>::type * =
+          nullptr) const {
     return m_local_dim0;
   }
 
+  template <typename T = Traits>
+  KOKKOS_INLINE_FUNCTION constexpr size_t dimension_0(
+      typename std::enable_if<is_distributed_layout_left<
+          typename T::array_layout>::value>::type * = nullptr) const {
+    return m_offset.dimension_0();
+  }
+
   template <typename T = Traits>
   KOKKOS_INLINE_FUNCTION constexpr size_t dimension_0(
       typename std::enable_if<
@@ -482,6 +565,68 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     return m_handle.ptr;
   }
 
+  /** \brief  Query the backend data handle */
+  KOKKOS_INLINE_FUNCTION const handle_type &handle() const { return m_handle; }
+
+  /** \brief  Query the PEs the view is distributed over */
+  KOKKOS_INLINE_FUNCTION int impl_num_pes() const { return m_num_pes; }
+  KOKKOS_INLINE_FUNCTION int impl_my_pe() const { return pe; }
+
+  /** \brief  Query the first global index of dim0 of a subview */
+  KOKKOS_INLINE_FUNCTION size_t impl_offset_remote_dim() const {
+    return m_offset_remote_dim;
+  }
+
+  /** \brief  PE holding all elements of a view and the handle offset of its
+   * first element. pe is -1 for views addressing the share of the calling PE
+   * through data() and -2 for subviews spanning several PEs */
+  struct owner_offsets {
+    int pe;
+    size_t offset;
+  };
+
+  /** \brief  Query the owner of the elements of a subview */
+  KOKKOS_INLINE_FUNCTION owner_offsets impl_owner() const {
+    constexpr bool partitioned =
+        std::is_same<layout, Kokkos::PartitionedLayoutLeft>::value ||
+        std::is_same<layout, Kokkos::PartitionedLayoutRight>::value ||
+        std::is_same<layout, Kokkos::PartitionedLayoutStride>::value;
+    const size_t n0 = m_offset.m_dim.N0;
+    if (partitioned) {
+      if (!dim0_is_pe || (m_is_subview && n0 == 1))
+        return {static_cast<int>(m_offset_remote_dim), 0};
+      return {m_is_subview ? -2 : -1, 0};
+    }
+    if (is_distributed_layout_left<layout>::value || !m_is_subview ||
+        unsigned(Traits::rank) == 0)
+      return {-1, 0};
+    if (!dim0_is_pe) return {-2, 0};
+    if (n0 == 0) return {-1, 0};
+    // Global index ranges map to a single PE if their first and last index
+    // do and the rows in between are consecutive there
+    const dim0_offsets first = compute_dim0_offsets(m_offset_remote_dim);
+    const dim0_offsets last =
+        compute_dim0_offsets(m_offset_remote_dim + n0 - 1);
+    if (first.pe != last.pe || last.offset - first.offset != n0 - 1)
+      return {-2, 0};
+    return {static_cast<int>(first.pe), first.offset * m_offset.stride_0()};
+  }
+
+  //----------------------------------------
+  // Elements owned by the calling PE are accessed through a direct load/store
+  // instead of the backend. Atomic views always go through the backend.
+
+ private:
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION reference_type get_element(const size_t target_pe,
+                                                    const iType &offset) const {
+    if (!Traits::memory_traits::is_atomic &&
+        target_pe == static_cast<size_t>(pe))
+      return m_handle.local(pe, offset);
+    return m_handle(target_pe, offset);
+  }
+
+ public:
   //----------------------------------------
   // The View class performs all rank and bounds checking before
   // calling these element reference methods.
@@ -504,7 +649,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
                         Kokkos::PartitionedLayoutStride>::value) &&
           RemoteSpaces_MemoryTraits<typename T::memory_traits>::dim0_is_pe>::
           type * = nullptr) const {
-    const reference_type element = m_handle(m_offset_remote_dim + i0, 0);
+    const reference_type element = get_element(m_offset_remote_dim + i0, 0);
     return element;
   }
 
@@ -521,7 +666,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
           RemoteSpaces_MemoryTraits<typename T::memory_traits>::dim0_is_pe>::
           type * = nullptr) const {
     const reference_type element =
-        m_handle(m_offset_remote_dim + i0, m_offset(0, i1));
+        get_element(m_offset_remote_dim + i0, m_offset(0, i1));
     return element;
   }
 
@@ -538,7 +683,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
           RemoteSpaces_MemoryTraits<typename T::memory_traits>::dim0_is_pe>::
           type * = nullptr) const {
     const reference_type element =
-        m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2));
+        get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2));
     return element;
   }
 
@@ -555,7 +700,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3) const {
     const reference_type element =
-        m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3));
+        get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3));
     return element;
   }
 
@@ -573,7 +718,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4) const {
     const reference_type element =
-        m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4));
+        get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4));
     return element;
   }
 
@@ -591,7 +736,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5) const {
     const reference_type element =
-        m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5));
+        get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5));
     return element;
   }
 
@@ -608,8 +753,8 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6) const {
-    const reference_type element =
-        m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5, i6));
+    const reference_type element = get_element(
+        m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5, i6));
     return element;
   }
 
@@ -626,7 +771,7 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6, const I7 &i7) const {
-    const reference_type element = m_handle(
+    const reference_type element = get_element(
         m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5, i6, i7));
     return element;
   }
@@ -652,11 +797,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     // for auto sub_v = View_t(v,...).
 
     if (dim0_is_pe) {
-      const reference_type element = m_handle(m_offset_remote_dim + i0, 0);
+      const reference_type element = get_element(m_offset_remote_dim + i0, 0);
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(i0));
+          get_element(m_offset_remote_dim, m_offset(i0));
       return element;
     }
   }
@@ -675,11 +820,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
           type * = nullptr) const {
     if (dim0_is_pe) {
       const reference_type element =
-          m_handle(m_offset_remote_dim + i0, m_offset(0, i1));
+          get_element(m_offset_remote_dim + i0, m_offset(0, i1));
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(i0, i1));
+          get_element(m_offset_remote_dim, m_offset(i0, i1));
       return element;
     }
   }
@@ -698,11 +843,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
           type * = nullptr) const {
     if (dim0_is_pe) {
       const reference_type element =
-          m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2));
+          get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2));
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(0, i1, i2));
+          get_element(m_offset_remote_dim, m_offset(0, i1, i2));
       return element;
     }
   }
@@ -721,11 +866,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3) const {
     if (dim0_is_pe) {
       const reference_type element =
-          m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3));
+          get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3));
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(0, i1, i2, i3));
+          get_element(m_offset_remote_dim, m_offset(0, i1, i2, i3));
       return element;
     }
   }
@@ -745,11 +890,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
             const I4 &i4) const {
     if (dim0_is_pe) {
       const reference_type element =
-          m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4));
+          get_element(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4));
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(0, i1, i2, i3, i4));
+          get_element(m_offset_remote_dim, m_offset(0, i1, i2, i3, i4));
       return element;
     }
   }
@@ -768,12 +913,12 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5) const {
     if (dim0_is_pe) {
-      const reference_type element =
-          m_handle(m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5));
+      const reference_type element = get_element(
+          m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5));
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(0, i1, i2, i3, i4, i5));
+          get_element(m_offset_remote_dim, m_offset(0, i1, i2, i3, i4, i5));
       return element;
     }
   }
@@ -792,12 +937,12 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6) const {
     if (dim0_is_pe) {
-      const reference_type element = m_handle(
+      const reference_type element = get_element(
           m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5, i6));
       return element;
     } else {
       const reference_type element =
-          m_handle(m_offset_remote_dim, m_offset(0, i1, i2, i3, i4, i5, i6));
+          get_element(m_offset_remote_dim, m_offset(0, i1, i2, i3, i4, i5, i6));
       return element;
     }
   }
@@ -816,11 +961,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6, const I7 &i7) const {
     if (dim0_is_pe) {
-      const reference_type element = m_handle(
+      const reference_type element = get_element(
           m_offset_remote_dim + i0, m_offset(0, i1, i2, i3, i4, i5, i6, i7));
       return element;
     } else {
-      const reference_type element = m_handle(
+      const reference_type element = get_element(
           m_offset_remote_dim, m_offset(0, i1, i2, i3, i4, i5, i6, i7));
       return element;
     }
@@ -838,14 +983,66 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   // on RemoteSpace space type for all default layouts and also one for
   // all partitioned laytouts. Wait for mdspan.)
   template <typename I0, typename T = Traits>
-  KOKKOS_INLINE_FUNCTION dim0_offsets
+  KOKKOS_INLINE_FUNCTION typename std::enable_if<
+      !is_irregular_layout<typename T::array_layout>::value, dim0_offsets>::type
   compute_dim0_offsets(const I0 &_i0) const {
-    size_t target_pe, dim0_mod, i0;
-    i0 = static_cast<size_t>(_i0);
+    const size_t i0 = static_cast<size_t>(_i0);
+    if (is_block_cyclic_layout<typename T::array_layout>::value) {
+      // Blocks of block_size indices are dealt round-robin to the PEs
+      constexpr size_t block_size =
+          block_cyclic_size<typename T::array_layout>::value;
+      const size_t block = i0 / block_size;
+      return {block % m_num_pes,
+              (block / m_num_pes) * block_size + i0 % block_size};
+    }
+    // Halo layouts store the share of a PE after its leading ghost rows
+    constexpr size_t ghosts = halo_width<typename T::array_layout>::value;
+    if (m_dim0_shift >= 0)
+      return {i0 >> m_dim0_shift, (i0 & m_dim0_mask) + ghosts};
     assert(m_local_dim0);
-    target_pe = i0 / m_local_dim0;
-    dim0_mod  = i0 % m_local_dim0;
-    return {target_pe, dim0_mod};
+    return {i0 / m_local_dim0, i0 % m_local_dim0 + ghosts};
+  }
+
+  template <typename I0, typename T = Traits>
+  KOKKOS_INLINE_FUNCTION typename std::enable_if<
+      is_irregular_layout<typename T::array_layout>::value, dim0_offsets>::type
+  compute_dim0_offsets(const I0 &_i0) const {
+    const size_t i0 = static_cast<size_t>(_i0);
+#if defined(KOKKOS_ENABLE_DEBUG)
+    if (i0 >= m_pe_offsets(m_num_pes))
+      Kokkos::abort("IrregularLayout index exceeds the global extent");
+#endif
+    // Binary search for the last PE starting at or before i0. This skips
+    // PEs owning no indices
+    int lo = 0, hi = m_num_pes - 1;
+    while (lo < hi) {
+      const int mid = (lo + hi + 1) / 2;
+      if (m_pe_offsets(mid) <= i0)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+    return {size_t(lo), i0 - m_pe_offsets(lo)};
+  }
+
+  // Layouts distributed along a chosen dimension translate that index
+  template <std::size_t... Dims, typename... Is>
+  KOKKOS_INLINE_FUNCTION const reference_type distributed_reference(
+      std::index_sequence<Dims...>, const Is &... is) const {
+    constexpr unsigned dim   = distributed_dim<layout>::value;
+    size_t idx[]             = {static_cast<size_t>(is)...};
+    dim0_offsets _dim_offset = compute_dim0_offsets(idx[dim]);
+    idx[dim]                 = _dim_offset.offset;
+    return get_element(_dim_offset.pe, m_offset(idx[Dims]...));
+  }
+
+  template <typename... Is, typename T = Traits>
+  KOKKOS_INLINE_FUNCTION const typename std::enable_if<
+      is_distributed_layout_left<typename T::array_layout>::value &&
+          sizeof...(Is) == T::rank,
+      reference_type>::type
+  reference(const Is &... is) const {
+    return distributed_reference(std::index_sequence_for<Is...>(), is...);
   }
 
   template <typename I0, typename T = Traits>
@@ -855,15 +1052,12 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
       typename std::enable_if<
           std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout,
-                       Kokkos::LayoutStride>::value>::type * = nullptr) const {
-    if (m_num_pes <= 1) {
-      const reference_type element = m_handle(0, m_offset(i0));
-      return element;
-    }
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value>::type * =
+          nullptr) const {
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
     const reference_type element =
-        m_handle(_dim0_offset.pe, m_offset(_dim0_offset.offset));
+        get_element(_dim0_offset.pe, m_offset(_dim0_offset.offset));
     return element;
   }
 
@@ -871,16 +1065,13 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(const I0 &i0, const I1 &i1) const {
-    if (m_num_pes <= 1) {
-      const reference_type element = m_handle(0, m_offset(i0, i1));
-      return element;
-    }
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
     const reference_type element =
-        m_handle(_dim0_offset.pe, m_offset(_dim0_offset.offset, i1));
+        get_element(_dim0_offset.pe, m_offset(_dim0_offset.offset, i1));
     return element;
   }
 
@@ -888,21 +1079,19 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(
       const I0 &i0, const I1 &i1, const I2 &i2,
       typename std::enable_if<
           std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
-          std::is_same<typename T::array_layout,
-                       Kokkos::LayoutRight>::value>::type * = nullptr) const {
-    if (m_num_pes <= 1) {
-      const reference_type element = m_handle(0, m_offset(i0, i1, i2));
-      return element;
-    }
+          std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
+          is_right_global_layout<typename T::array_layout>::value>::type * =
+          nullptr) const {
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
     const reference_type element =
-        m_handle(_dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2));
+        get_element(_dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2));
     return element;
   }
 
@@ -911,16 +1100,13 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3) const {
-    if (m_num_pes <= 1) {
-      const reference_type element = m_handle(0, m_offset(i0, i1, i2, i3));
-      return element;
-    }
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
     const reference_type element =
-        m_handle(_dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2, i3));
+        get_element(_dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2, i3));
     return element;
   }
 
@@ -929,16 +1115,13 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4) const {
-    if (m_num_pes <= 1) {
-      const reference_type element = m_handle(0, m_offset(i0, i1, i2, i3, i4));
-      return element;
-    }
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
-    const reference_type element = m_handle(
+    const reference_type element = get_element(
         _dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2, i3, i4));
     return element;
   }
@@ -948,17 +1131,13 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5) const {
-    if (m_num_pes <= 1) {
-      const reference_type element =
-          m_handle(0, m_offset(i0, i1, i2, i3, i4, i5));
-      return element;
-    }
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
-    const reference_type element = m_handle(
+    const reference_type element = get_element(
         _dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2, i3, i4, i5));
     return element;
   }
@@ -968,17 +1147,13 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6) const {
-    if (m_num_pes <= 1) {
-      const reference_type element =
-          m_handle(0, m_offset(i0, i1, i2, i3, i4, i5, i6));
-      return element;
-    }
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
-    const reference_type element = m_handle(
+    const reference_type element = get_element(
         _dim0_offset.pe, m_offset(_dim0_offset.offset, i1, i2, i3, i4, i5, i6));
     return element;
   }
@@ -988,18 +1163,14 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_INLINE_FUNCTION const typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
           std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
-          std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value,
+          std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
+          is_right_global_layout<typename T::array_layout>::value,
       reference_type>::type
   reference(const I0 &i0, const I1 &i1, const I2 &i2, const I3 &i3,
             const I4 &i4, const I5 &i5, const I6 &i6, const I7 &i7) const {
-    if (m_num_pes <= 1) {
-      const reference_type element =
-          m_handle(0, m_offset(i0, i1, i2, i3, i4, i5, i6, i7));
-      return element;
-    }
     dim0_offsets _dim0_offset = compute_dim0_offsets(m_offset_remote_dim + i0);
     const reference_type element =
-        m_handle(_dim0_offset.pe,
+        get_element(_dim0_offset.pe,
                  m_offset(_dim0_offset.offset, i1, i2, i3, i4, i5, i6, i7));
     return element;
   }
@@ -1036,10 +1207,12 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
         m_offset(),
         m_offset_remote_dim(0),
         m_local_dim0(0),
-        dim0_is_pe(1) {
-    m_num_pes = Kokkos::Experimental::get_num_pes();
-    pe        = Kokkos::Experimental::get_my_pe();
-  }
+        m_dim0_shift(-1),
+        m_dim0_mask(0),
+        dim0_is_pe(1),
+        m_is_subview(false),
+        m_num_pes(0),
+        pe(0) {}
 
   KOKKOS_INLINE_FUNCTION ViewMapping(const ViewMapping &rhs)
       : m_handle(rhs.m_handle),
@@ -1048,7 +1221,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
         pe(rhs.pe),
         m_offset_remote_dim(rhs.m_offset_remote_dim),
         m_local_dim0(rhs.m_local_dim0),
-        dim0_is_pe(rhs.dim0_is_pe) {}
+        m_dim0_shift(rhs.m_dim0_shift),
+        m_dim0_mask(rhs.m_dim0_mask),
+        m_pe_offsets(rhs.m_pe_offsets),
+        dim0_is_pe(rhs.dim0_is_pe),
+        m_is_subview(rhs.m_is_subview) {}
 
   KOKKOS_INLINE_FUNCTION ViewMapping &operator=(const ViewMapping &rhs) {
     m_handle            = rhs.m_handle;
@@ -1056,7 +1233,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     m_num_pes           = rhs.m_num_pes;
     m_offset_remote_dim = rhs.m_offset_remote_dim;
     m_local_dim0        = rhs.m_local_dim0;
+    m_dim0_shift        = rhs.m_dim0_shift;
+    m_dim0_mask         = rhs.m_dim0_mask;
+    m_pe_offsets        = rhs.m_pe_offsets;
     dim0_is_pe          = rhs.dim0_is_pe;
+    m_is_subview        = rhs.m_is_subview;
     pe                  = rhs.pe;
     return *this;
   }
@@ -1068,7 +1249,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
         pe(rhs.pe),
         m_offset_remote_dim(rhs.m_offset_remote_dim),
         m_local_dim0(rhs.m_local_dim0),
-        dim0_is_pe(0) {}
+        m_dim0_shift(rhs.m_dim0_shift),
+        m_dim0_mask(rhs.m_dim0_mask),
+        m_pe_offsets(rhs.m_pe_offsets),
+        dim0_is_pe(rhs.dim0_is_pe),
+        m_is_subview(rhs.m_is_subview) {}
 
   KOKKOS_INLINE_FUNCTION ViewMapping &operator=(ViewMapping &&rhs) {
     m_handle            = rhs.m_handle;
@@ -1077,7 +1262,11 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     pe                  = rhs.pe;
     m_offset_remote_dim = rhs.m_offset_remote_dim;
     m_local_dim0        = rhs.m_local_dim0;
+    m_dim0_shift        = rhs.m_dim0_shift;
+    m_dim0_mask         = rhs.m_dim0_mask;
+    m_pe_offsets        = rhs.m_pe_offsets;
     dim0_is_pe          = rhs.dim0_is_pe;
+    m_is_subview        = rhs.m_is_subview;
     return *this;
   }
 
@@ -1091,7 +1280,9 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
       : m_offset_remote_dim(0),
         m_handle(
             ((Kokkos::Impl::ViewCtorProp<void, pointer_type> const &)arg_prop)
-                .value) {
+                .value),
+        dim0_is_pe(1),
+        m_is_subview(false) {
     typedef typename Traits::value_type value_type;
     typedef std::integral_constant<
         unsigned, Kokkos::Impl::ViewCtorProp<P...>::allow_padding
@@ -1101,12 +1292,22 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
 
     typename Traits::array_layout layout;
 
+#if defined(KOKKOS_ENABLE_MPISPACE)
+    // Memory of an allocation is numbered within its communicator
+    const Kokkos::Experimental::MPISpace space(
+        Kokkos::Experimental::MPISpace::get_comm(
+            ((Kokkos::Impl::ViewCtorProp<void, pointer_type> const &)arg_prop)
+                .value));
+#else
+    const typename Traits::memory_space space;
+#endif
+    m_num_pes = space.impl_get_num_pes();
+    pe        = space.impl_get_my_pe();
+
     // Copy layout properties
     set_layout(arg_layout, layout, m_local_dim0);
 
-    m_offset  = offset_type(padding(), layout);
-    m_num_pes = Kokkos::Experimental::get_num_pes();
-    pe        = Kokkos::Experimental::get_my_pe();
+    m_offset = offset_type(padding(), layout);
   }
 
   /**\brief  Assign data */
@@ -1118,16 +1319,107 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
   KOKKOS_FUNCTION typename std::enable_if<
       std::is_same<typename T::array_layout, Kokkos::LayoutRight>::value ||
       std::is_same<typename T::array_layout, Kokkos::LayoutLeft>::value ||
-      std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value>::type
+      std::is_same<typename T::array_layout, Kokkos::LayoutStride>::value ||
+      is_distributed_layout_left<typename T::array_layout>::value ||
+      is_halo_layout<typename T::array_layout>::value>::type
   set_layout(typename T::array_layout const &arg_layout,
              typename T::array_layout &layout, size_t &local_dim0) {
+    constexpr unsigned dim = distributed_dim<typename T::array_layout>::value;
     for (int i = 0; i < T::rank; i++)
       layout.dimension[i] = arg_layout.dimension[i];
 
-    local_dim0 =
-        Kokkos::Experimental::get_indexing_block_size(arg_layout.dimension[0]);
+    // Block size over the PEs of the view's memory space instance
+    local_dim0 = (arg_layout.dimension[dim] + m_num_pes - 1) / m_num_pes;
+    if (RemoteSpaces_MemoryTraits<
+            typename T::memory_traits>::is_power_of_two_blocks) {
+      size_t block = 1;
+      while (block < local_dim0) block <<= 1;
+      local_dim0 = block;
+    }
     // We overallocate potentially in favor of symmetric memory allocation
+    layout.dimension[dim] =
+        local_dim0 + 2 * halo_width<typename T::array_layout>::value;
+
+    m_dim0_shift = -1;
+    m_dim0_mask  = 0;
+    if (m_num_pes <= 1) {
+      // A single PE owns all indices
+      m_dim0_shift = 63;
+      m_dim0_mask  = ~size_t(0);
+    } else if (local_dim0 && !(local_dim0 & (local_dim0 - 1))) {
+      m_dim0_shift = 0;
+      while ((size_t(1) << m_dim0_shift) < local_dim0) ++m_dim0_shift;
+      m_dim0_mask = local_dim0 - 1;
+    }
+  }
+
+  template <typename T = Traits>
+  KOKKOS_FUNCTION typename std::enable_if<
+      is_block_cyclic_layout<typename T::array_layout>::value>::type
+  set_layout(typename T::array_layout const &arg_layout,
+             typename T::array_layout &layout, size_t &local_dim0) {
+    constexpr size_t block_size =
+        block_cyclic_size<typename T::array_layout>::value;
+    for (int i = 0; i < T::rank; i++)
+      layout.dimension[i] = arg_layout.dimension[i];
+
+    // Every PE stores the same number of whole blocks
+    const size_t num_blocks =
+        (arg_layout.dimension[0] + block_size - 1) / block_size;
+    local_dim0 = ((num_blocks + m_num_pes - 1) / m_num_pes) * block_size;
     layout.dimension[0] = local_dim0;
+
+    m_dim0_shift = -1;
+    m_dim0_mask  = 0;
+  }
+
+  // The partition table is a host array, so irregular views are created on
+  // the host only. The table must start at zero and never decrease. If the
+  // layout sets dimension[0], the table must end at that global extent
+  template <typename T = Traits>
+  KOKKOS_FUNCTION typename std::enable_if<
+      is_irregular_layout<typename T::array_layout>::value>::type
+  set_layout(typename T::array_layout const &arg_layout,
+             typename T::array_layout &layout, size_t &local_dim0) {
+#if defined(KOKKOS_ACTIVE_EXECUTION_MEMORY_SPACE_HOST)
+    const size_t *offsets = arg_layout.pe_offsets;
+    if (!offsets) Kokkos::abort("IrregularLayout requires a partition table");
+    if (offsets[0] != 0)
+      Kokkos::abort("IrregularLayout partition table must start at zero");
+
+    size_t max_extent = 0;
+    for (int p = 0; p < m_num_pes; ++p) {
+      if (offsets[p + 1] < offsets[p])
+        Kokkos::abort("IrregularLayout partition table must be sorted");
+      if (offsets[p + 1] - offsets[p] > max_extent)
+        max_extent = offsets[p + 1] - offsets[p];
+    }
+    if (arg_layout.dimension[0] &&
+        offsets[m_num_pes] != arg_layout.dimension[0])
+      Kokkos::abort(
+          "IrregularLayout partition table must end at the global extent");
+
+    for (int i = 0; i < T::rank; i++)
+      layout.dimension[i] = arg_layout.dimension[i];
+
+    m_pe_offsets    = pe_offsets_type("PartitionTable", m_num_pes + 1);
+    auto pe_offsets = Kokkos::create_mirror_view(m_pe_offsets);
+    for (int p = 0; p <= m_num_pes; ++p) pe_offsets(p) = offsets[p];
+    Kokkos::deep_copy(m_pe_offsets, pe_offsets);
+
+    // The view spans the share of this PE while symmetric allocation
+    // requires the same size on all PEs
+    local_dim0          = offsets[pe + 1] - offsets[pe];
+    layout.dimension[0] = max_extent;
+
+    m_dim0_shift = -1;
+    m_dim0_mask  = 0;
+#else
+    (void)arg_layout;
+    (void)layout;
+    (void)local_dim0;
+    Kokkos::abort("IrregularLayout views must be created on the host");
+#endif
   }
 
   template <typename T = Traits>
@@ -1146,6 +1438,8 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     // Override
     layout.dimension[0] = 1;
     local_dim0          = 0;
+    m_dim0_shift        = -1;
+    m_dim0_mask         = 0;
   }
 
  public:
@@ -1175,12 +1469,17 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
         padding;
     typename T::array_layout layout;
 
+    const memory_space &space =
+        ((Kokkos::Impl::ViewCtorProp<void, memory_space> const &)arg_prop)
+            .value;
+
+    // PEs are numbered within the group spanned by the memory space instance
+    m_num_pes = space.impl_get_num_pes();
+    pe        = space.impl_get_my_pe();
+
     // Copy layout properties
     set_layout(arg_layout, layout, m_local_dim0);
 
-    m_num_pes = Kokkos::Experimental::get_num_pes();
-    pe        = Kokkos::Experimental::get_my_pe();
-
     m_offset = offset_type(padding(), layout);
 
     const size_t alloc_size = memory_span();
@@ -1188,16 +1487,26 @@ class ViewMapping<Traits, Kokkos::Experimental::RemoteSpaceSpecializeTag> {
     // Create shared memory tracking record with allocate memory from the memory
     // space
     record_type *const record = record_type::allocate(
-        ((Kokkos::Impl::ViewCtorProp<void, memory_space> const &)arg_prop)
-            .value,
+        space,
         ((Kokkos::Impl::ViewCtorProp<void, std::string> const &)arg_prop).value,
         alloc_size);
 
-#ifdef KOKKOS_ENABLE_MPISPACE
+#if defined(KOKKOS_ENABLE_MPISPACE)
     if (alloc_size) {
       m_handle = handle_type(reinterpret_cast<pointer_type>(record->data()),
                              record->win);
     }
+#elif defined(KOKKOS_ENABLE_SHMEMSPACE)
+    if (alloc_size) {
+      // Element reads of cached allocations go through the read cache
+      const size_t cached_size =
+          space.allocation_mode == Kokkos::Experimental::Cached ? alloc_size
+                                                                : 0;
+      m_handle = handle_type(reinterpret_cast<pointer_type>(record->data()),
+                             record->peer_ptrs.data(),
+                             reinterpret_cast<char *>(record->data()),
+                             cached_size);
+    }
 #else
     if (alloc_size) {
       m_handle = handle_type(reinterpret_cast<pointer_type>(record->data()));
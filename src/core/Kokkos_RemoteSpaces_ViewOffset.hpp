@@ -1642,6 +1642,100 @@ struct ViewOffset<Dimension, Kokkos::PartitionedLayoutStride, void> {
             stride(sub.range_index(6), rhs), stride(sub.range_index(7), rhs)) {}
 };
 
+//----------------------------------------------------------------------------
+// Global layouts storing the share of a PE in the order of a Kokkos layout.
+// Offsets are those of StorageLayout over the local extents
+template <class Dimension, class Layout, class StorageLayout>
+struct LocalStorageViewOffset
+    : public ViewOffset<Dimension, StorageLayout, void> {
+  using base_type    = ViewOffset<Dimension, StorageLayout, void>;
+  using array_layout = Layout;
+
+  KOKKOS_INLINE_FUNCTION array_layout layout() const {
+    array_layout l;
+    l.dimension[0] = this->m_dim.N0;
+    l.dimension[1] = this->m_dim.N1;
+    l.dimension[2] = this->m_dim.N2;
+    l.dimension[3] = this->m_dim.N3;
+    l.dimension[4] = this->m_dim.N4;
+    l.dimension[5] = this->m_dim.N5;
+    l.dimension[6] = this->m_dim.N6;
+    l.dimension[7] = this->m_dim.N7;
+    return l;
+  }
+
+  LocalStorageViewOffset()                               = default;
+  LocalStorageViewOffset(const LocalStorageViewOffset &) = default;
+  LocalStorageViewOffset &operator=(const LocalStorageViewOffset &) = default;
+
+  template <unsigned TrivialScalarSize>
+  KOKKOS_INLINE_FUNCTION constexpr LocalStorageViewOffset(
+      std::integral_constant<unsigned, TrivialScalarSize> const &padding,
+      array_layout const &arg_layout)
+      : base_type(padding,
+                  StorageLayout(
+                      arg_layout.dimension[0], arg_layout.dimension[1],
+                      arg_layout.dimension[2], arg_layout.dimension[3],
+                      arg_layout.dimension[4], arg_layout.dimension[5],
+                      arg_layout.dimension[6], arg_layout.dimension[7])) {}
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION constexpr LocalStorageViewOffset(
+      const ViewOffset<DimRHS, Layout, void> &rhs)
+      : base_type(
+            static_cast<const ViewOffset<DimRHS, StorageLayout, void> &>(rhs)) {
+  }
+
+  //----------------------------------------
+  // Subview construction
+
+  template <class DimRHS>
+  KOKKOS_INLINE_FUNCTION constexpr LocalStorageViewOffset(
+      const ViewOffset<DimRHS, Layout, void> &rhs,
+      const SubviewExtents<DimRHS::rank, Dimension::rank> &sub)
+      : base_type(
+            static_cast<const ViewOffset<DimRHS, StorageLayout, void> &>(rhs),
+            sub) {}
+};
+
+// BlockCyclicLayout : the local blocks of a PE are stored in LayoutRight order
+template <class Dimension, size_t B>
+struct ViewOffset<Dimension, Kokkos::BlockCyclicLayout<B>, void>
+    : public LocalStorageViewOffset<Dimension, Kokkos::BlockCyclicLayout<B>,
+                                    Kokkos::LayoutRight> {
+  using LocalStorageViewOffset<Dimension, Kokkos::BlockCyclicLayout<B>,
+                               Kokkos::LayoutRight>::LocalStorageViewOffset;
+};
+
+// DistributedLayoutLeft : the share of a PE is stored in LayoutLeft order
+template <class Dimension, unsigned Dim>
+struct ViewOffset<Dimension, Kokkos::DistributedLayoutLeft<Dim>, void>
+    : public LocalStorageViewOffset<Dimension,
+                                    Kokkos::DistributedLayoutLeft<Dim>,
+                                    Kokkos::LayoutLeft> {
+  using LocalStorageViewOffset<Dimension, Kokkos::DistributedLayoutLeft<Dim>,
+                               Kokkos::LayoutLeft>::LocalStorageViewOffset;
+};
+
+// IrregularLayout : the share of a PE is stored in LayoutRight order
+template <class Dimension>
+struct ViewOffset<Dimension, Kokkos::IrregularLayout, void>
+    : public LocalStorageViewOffset<Dimension, Kokkos::IrregularLayout,
+                                    Kokkos::LayoutRight> {
+  using LocalStorageViewOffset<Dimension, Kokkos::IrregularLayout,
+                               Kokkos::LayoutRight>::LocalStorageViewOffset;
+};
+
+// HaloLayout : the share of a PE and its ghost rows are stored in
+// LayoutRight order
+template <class Dimension, size_t W>
+struct ViewOffset<Dimension, Kokkos::HaloLayout<W>, void>
+    : public LocalStorageViewOffset<Dimension, Kokkos::HaloLayout<W>,
+                                    Kokkos::LayoutRight> {
+  using LocalStorageViewOffset<Dimension, Kokkos::HaloLayout<W>,
+                               Kokkos::LayoutRight>::LocalStorageViewOffset;
+};
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -44,17 +44,295 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_MPISpace.hpp>
+#include <Kokkos_RemoteSpaces_SymmetricArena.hpp>
+#include <algorithm>
 #include <csignal>
+#include <limits>
+#include <map>
 #include <mpi.h>
 
 namespace Kokkos {
+namespace Impl {
+
+MPIWindow::MPIWindow(MPI_Win win_, MPI_Comm comm_, size_t size_,
+                     MPI_Aint disp_)
+    : mpi_win(win_),
+      comm(comm_),
+      size(size_),
+      disp(disp_),
+      owns_windows(true),
+      cached(false),
+      shm_win(MPI_WIN_NULL) {
+  int num_ranks;
+  MPI_Comm_size(comm, &num_ranks);
+  dirty = std::vector<std::atomic<uint64_t>>((num_ranks + 63) / 64);
+}
+
+void MPIWindow::flush_dirty() {
+  for (size_t w = 0; w < dirty.size(); ++w) {
+    uint64_t bits = dirty[w].exchange(0, std::memory_order_relaxed);
+    for (int pe = w * 64; bits; bits >>= 1, ++pe) {
+      if (bits & 1) MPI_Win_flush(pe, mpi_win);
+    }
+  }
+}
+
+// Orders direct loads and stores to node-local peers
+void MPIWindow::sync() {
+  if (shm_win != MPI_WIN_NULL) MPI_Win_sync(shm_win);
+}
+
+}  // namespace Impl
+
+#ifdef KOKKOS_ENABLE_MPISPACE_SHARED_WINDOWS
+namespace {
+
+// Resolve the segments of all same-node ranks to local addresses
+void set_node_ptrs(Kokkos::Impl::MPIWindow &window, MPI_Comm node_comm) {
+  MPI_Group world_group, node_group;
+  MPI_Comm_group(window.comm, &world_group);
+  MPI_Comm_group(node_comm, &node_group);
+
+  int num_ranks;
+  MPI_Comm_size(window.comm, &num_ranks);
+
+  int node_size;
+  MPI_Comm_size(node_comm, &node_size);
+  std::vector<int> node_ranks(node_size), world_ranks(node_size);
+  for (int r = 0; r < node_size; ++r) node_ranks[r] = r;
+  MPI_Group_translate_ranks(node_group, node_size, node_ranks.data(),
+                            world_group, world_ranks.data());
+
+  window.node_ptrs.assign(num_ranks, nullptr);
+  for (int r = 0; r < node_size; ++r) {
+    MPI_Aint size;
+    int disp_unit;
+    void *base;
+    MPI_Win_shared_query(window.shm_win, r, &size, &disp_unit, &base);
+    window.node_ptrs[world_ranks[r]] = static_cast<char *>(base);
+  }
+
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&world_group);
+}
+
+}  // namespace
+#endif
+
+namespace {
+
+void free_window(Kokkos::Impl::MPIWindow *window) {
+  MPI_Win_unlock_all(window->mpi_win);
+  MPI_Win_free(&window->mpi_win);
+  if (window->shm_win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(window->shm_win);
+    MPI_Win_free(&window->shm_win);
+  }
+  delete window;
+}
+
+// Creates a window of size bytes over comm, locked for passive target access
+Kokkos::Impl::MPIWindow *create_window(const size_t size, MPI_Comm comm,
+                                       void **ptr) {
+  MPI_Win win = MPI_WIN_NULL;
+
+  // Concurrent accumulates to the same element use the same operation
+  // (or MPI_NO_OP for atomic reads). This allows implementations to
+  // map remote atomics onto hardware (NIC) atomics.
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "accumulate_ops", "same_op_no_op");
+#ifdef KOKKOS_ENABLE_MPISPACE_SHARED_WINDOWS
+  // Allocate from node-local shared memory such that same-node ranks can
+  // access each other's segments with loads and stores, and expose the
+  // same memory to all ranks through a second window
+  MPI_Comm node_comm;
+  MPI_Win shm_win = MPI_WIN_NULL;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                      &node_comm);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+  MPI_Win_allocate_shared(size, 1, info, node_comm, ptr, &shm_win);
+  MPI_Win_create(*ptr, size, 1, info, comm, &win);
+#else
+  MPI_Win_allocate(size, 1, info, comm, ptr, &win);
+#endif
+  MPI_Info_free(&info);
+
+  assert(win != MPI_WIN_NULL);
+
+  int ret = MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+  if (ret != MPI_SUCCESS) {
+    Kokkos::abort("MPI window lock all failed.");
+  }
+  Kokkos::Impl::MPIWindow *window =
+      new Kokkos::Impl::MPIWindow(win, comm, size);
+
+#ifdef KOKKOS_ENABLE_MPISPACE_SHARED_WINDOWS
+  ret = MPI_Win_lock_all(MPI_MODE_NOCHECK, shm_win);
+  if (ret != MPI_SUCCESS) {
+    Kokkos::abort("MPI shared window lock all failed.");
+  }
+  window->shm_win = shm_win;
+  set_node_ptrs(*window, node_comm);
+  MPI_Comm_free(&node_comm);
+#endif
+
+  return window;
+}
+
+// Symmetric arena over MPI_COMM_WORLD. Allocations from the arena share its
+// windows and address their data by displacement.
+struct MPIArena {
+  Kokkos::Impl::MPIWindow *window;
+  Kokkos::Impl::SymmetricArena allocator;
+
+  MPIArena(Kokkos::Impl::MPIWindow *window_, void *base, size_t size)
+      : window(window_),
+        allocator(base, size, Kokkos::Impl::MEMORY_ALIGNMENT) {}
+
+  Kokkos::Impl::MPIWindow *alias_window(void *ptr, size_t size) const {
+    Kokkos::Impl::MPIWindow *alias = new Kokkos::Impl::MPIWindow(
+        window->mpi_win, window->comm, size,
+        static_cast<char *>(ptr) - allocator.get_base() +
+            sizeof(Kokkos::Impl::SharedAllocationHeader));
+    alias->shm_win      = window->shm_win;
+    alias->node_ptrs    = window->node_ptrs;
+    alias->owns_windows = false;
+    return alias;
+  }
+};
+
+// Reserved by the first allocation if KOKKOS_REMOTE_SPACES_ARENA_SIZE is set
+MPIArena *get_arena() {
+  static MPIArena *arena = []() -> MPIArena * {
+    const size_t size = Kokkos::Impl::get_symmetric_arena_size();
+    if (!size) return nullptr;
+    void *base;
+    MPIArena *a =
+        new MPIArena(create_window(size, MPI_COMM_WORLD, &base), base, size);
+    Kokkos::push_finalize_hook([a]() {
+      free_window(a->window);
+      delete a;
+    });
+    return a;
+  }();
+  return arena;
+}
+
+#ifdef KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE
+// Released windows by size class. Allocations and deallocations happen in
+// the same order on all ranks of a communicator, so the ranks hit or miss the
+// cache together and recycle matching windows without creating new ones.
+// A hit still synchronizes the ranks of the communicator like the window
+// creation it replaces.
+struct WindowCache {
+  using entry_type = std::pair<void *, Kokkos::Impl::MPIWindow *>;
+  std::mutex mutex;
+  std::map<size_t, std::vector<entry_type>> windows;
+  size_t hits        = 0;
+  size_t misses      = 0;
+  bool finalize_hook = false;
+  // Attribute of communicators with cached windows
+  int keyval = MPI_KEYVAL_INVALID;
+};
+
+constexpr size_t max_cached_windows_per_class = 16;
+
+WindowCache &get_window_cache() {
+  static WindowCache cache;
+  return cache;
+}
+
+// Rounds up to one of four size classes per power of two (< 25% overhead)
+size_t window_size_class(const size_t size) {
+  if (size <= 64) return 64;
+  size_t pow2 = 64;
+  while (pow2 < size) pow2 <<= 1;
+  const size_t step = pow2 / 8;
+  return (size + step - 1) / step * step;
+}
+
+// Frees the cached windows over comm, or all if comm is MPI_COMM_NULL.
+// Collective over the communicators of the freed windows.
+void release_cached_windows(MPI_Comm comm) {
+  WindowCache &cache = get_window_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  for (auto &size_class : cache.windows) {
+    auto &entries = size_class.second;
+    for (auto it = entries.begin(); it != entries.end();) {
+      if (comm == MPI_COMM_NULL || it->second->comm == comm) {
+        free_window(it->second);
+        it = entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+// Delete callback of the cache attribute. Freeing a communicator releases
+// its cached windows before MPI can reuse the handle for another one, so
+// entries never match a different communicator with the same handle value
+int release_comm_windows(MPI_Comm comm, int, void *, void *) {
+  release_cached_windows(comm);
+  return MPI_SUCCESS;
+}
+
+Kokkos::Impl::MPIWindow *take_cached_window(const size_t size, MPI_Comm comm,
+                                            void **ptr) {
+  WindowCache &cache = get_window_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto &entries = cache.windows[size];
+  for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+    if (it->second->comm == comm) {
+      Kokkos::Impl::MPIWindow *window = it->second;
+      *ptr                            = it->first;
+      entries.erase(std::next(it).base());
+      ++cache.hits;
+      return window;
+    }
+  }
+  ++cache.misses;
+  return nullptr;
+}
+
+bool cache_window(void *ptr, Kokkos::Impl::MPIWindow *window) {
+  WindowCache &cache = get_window_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto &entries = cache.windows[window->size];
+  if (entries.size() >= max_cached_windows_per_class) return false;
+  if (!cache.finalize_hook) {
+    Kokkos::push_finalize_hook([]() { release_cached_windows(MPI_COMM_NULL); });
+    cache.finalize_hook = true;
+  }
+  if (cache.keyval == MPI_KEYVAL_INVALID)
+    MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, release_comm_windows,
+                           &cache.keyval, nullptr);
+  // Setting a present attribute would run the callback
+  int flag;
+  void *value;
+  MPI_Comm_get_attr(window->comm, cache.keyval, &value, &flag);
+  if (!flag) MPI_Comm_set_attr(window->comm, cache.keyval, nullptr);
+  // Complete outstanding operations before the window is handed out again
+  window->flush_dirty();
+  entries.emplace_back(ptr, window);
+  return true;
+}
+#endif
+
+}  // namespace
+
 namespace Experimental {
 
-MPI_Win MPISpace::current_win;
-std::vector<MPI_Win> MPISpace::mpi_windows;
+std::map<const void *, Kokkos::Impl::MPIWindow *> MPISpace::mpi_windows;
+std::shared_timed_mutex MPISpace::mpi_windows_mutex;
 
 /* Default allocation mechanism */
-MPISpace::MPISpace() : allocation_mode(Kokkos::Experimental::Symmetric) {}
+MPISpace::MPISpace()
+    : allocation_mode(Kokkos::Experimental::Symmetric), comm(MPI_COMM_WORLD) {}
+
+MPISpace::MPISpace(const MPI_Comm &comm_)
+    : allocation_mode(Kokkos::Experimental::Symmetric), comm(comm_) {}
 
 void MPISpace::impl_set_allocation_mode(const int allocation_mode_) {
   allocation_mode = allocation_mode_;
@@ -62,6 +340,18 @@ void MPISpace::impl_set_allocation_mode(const int allocation_mode_) {
 
 void MPISpace::impl_set_extent(const int64_t extent_) { extent = extent_; }
 
+size_t MPISpace::impl_get_num_pes() const {
+  int n_ranks;
+  MPI_Comm_size(comm, &n_ranks);
+  return n_ranks;
+}
+
+size_t MPISpace::impl_get_my_pe() const {
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+  return rank;
+}
+
 void *MPISpace::allocate(const size_t arg_alloc_size) const {
   static_assert(sizeof(void *) == sizeof(uintptr_t),
                 "Error sizeof(void*) != sizeof(uintptr_t)");
@@ -72,102 +362,171 @@ void *MPISpace::allocate(const size_t arg_alloc_size) const {
 
   void *ptr = 0;
   if (arg_alloc_size) {
-    if (allocation_mode == Kokkos::Experimental::Symmetric) {
-      current_win = MPI_WIN_NULL;
-      MPI_Win_allocate(arg_alloc_size, 1, MPI_INFO_NULL, MPI_COMM_WORLD, &ptr,
-                       &current_win);
-
-      assert(current_win != MPI_WIN_NULL);
-
-      int ret = MPI_Win_lock_all(MPI_MODE_NOCHECK, current_win);
-      if (ret != MPI_SUCCESS) {
-        Kokkos::abort("MPI window lock all failed.");
+    // Cached allocations are symmetric allocations whose element reads go
+    // through the read cache
+    if (allocation_mode == Kokkos::Experimental::Symmetric ||
+        allocation_mode == Kokkos::Experimental::Cached) {
+      Kokkos::Impl::MPIWindow *window = nullptr;
+
+      // Serve from the symmetric arena unless disabled or exhausted
+      MPIArena *arena = comm == MPI_COMM_WORLD ? get_arena() : nullptr;
+      if (arena && (ptr = arena->allocator.allocate(arg_alloc_size))) {
+        window = arena->alias_window(ptr, arg_alloc_size);
+        // Arena blocks skip the barrier of the collective window creation,
+        // which keeps ranks from reusing memory that others still access
+        MPI_Barrier(comm);
       }
-      int i;
-      for (i = 0; i < mpi_windows.size(); ++i) {
-        if (mpi_windows[i] == MPI_WIN_NULL) break;
+
+#ifdef KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE
+      if (!window) {
+        const size_t alloc_size = window_size_class(arg_alloc_size);
+        window = take_cached_window(alloc_size, comm, &ptr);
+        // Recycled windows skip the barrier of the collective window
+        // creation, which keeps ranks from reusing memory that others
+        // still access
+        if (window)
+          MPI_Barrier(comm);
+        else
+          window = create_window(alloc_size, comm, &ptr);
       }
+#else
+      if (!window) window = create_window(arg_alloc_size, comm, &ptr);
+#endif
+      window->cached = allocation_mode == Kokkos::Experimental::Cached;
 
-      if (i == mpi_windows.size())
-        mpi_windows.push_back(current_win);
-      else
-        mpi_windows[i] = current_win;
+      std::lock_guard<std::shared_timed_mutex> lock(mpi_windows_mutex);
+      mpi_windows[ptr] = window;
     } else {
-      Kokkos::abort("MPISpace only supports symmetric allocation policy.");
+      Kokkos::abort("MPISpace only supports symmetric and cached allocation "
+                    "policies.");
     }
   }
   return ptr;
 }
 
-void MPISpace::deallocate(void *const, const size_t) const {
-  int last_valid;
-  for (last_valid = 0; last_valid < mpi_windows.size(); ++last_valid) {
-    if (mpi_windows[last_valid] == MPI_WIN_NULL) break;
-  }
+void MPISpace::deallocate(void *const arg_alloc_ptr, const size_t) const {
+  if (!arg_alloc_ptr) return;
 
-  last_valid--;
-  for (int i = 0; i < mpi_windows.size(); ++i) {
-    if (mpi_windows[i] == current_win) {
-      mpi_windows[i]          = mpi_windows[last_valid];
-      mpi_windows[last_valid] = MPI_WIN_NULL;
-      break;
+  Kokkos::Impl::MPIWindow *window;
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(mpi_windows_mutex);
+    auto it = mpi_windows.find(arg_alloc_ptr);
+    if (it == mpi_windows.end()) {
+      Kokkos::abort("MPISpace: deallocating unknown allocation.");
     }
+    window = it->second;
+    mpi_windows.erase(it);
+  }
+  // Lines of the allocation must not be served to a later one
+  if (window->cached) Kokkos::Impl::get_read_cache().forget(window);
+
+  if (!window->owns_windows) {
+    // Complete outstanding operations before the block is handed out again
+    window->flush_dirty();
+    get_arena()->allocator.deallocate(arg_alloc_ptr);
+    delete window;
+    return;
   }
 
-  assert(current_win != MPI_WIN_NULL);
-  MPI_Win_unlock_all(current_win);
-  MPI_Win_free(&current_win);
+#ifdef KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE
+  if (cache_window(arg_alloc_ptr, window)) return;
+#endif
+  free_window(window);
+}
 
-  // We pass a mempory space instance do multiple Views thus
-  // setting "current_win = MPI_WIN_NULL;" will result in a wrong handle if
-  // subsequent view runs out of scope
-  // Fixme: The following only works when views are allocated sequentially
-  // We need a thread-safe map to associate views and windows
+MPISpace::WindowCacheStats MPISpace::get_window_cache_stats() {
+  WindowCacheStats stats = {0, 0, 0};
+#ifdef KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE
+  WindowCache &cache = get_window_cache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  stats.hits   = cache.hits;
+  stats.misses = cache.misses;
+  for (auto &size_class : cache.windows)
+    stats.cached += size_class.second.size();
+#endif
+  return stats;
+}
+
+void MPISpace::impl_release_window_cache() const {
+#ifdef KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE
+  release_cached_windows(comm);
+#endif
+}
+
+Kokkos::Impl::MPIWindow *MPISpace::get_window(const void *arg_alloc_ptr) {
+  std::shared_lock<std::shared_timed_mutex> lock(mpi_windows_mutex);
+  auto it = mpi_windows.find(arg_alloc_ptr);
+  return it == mpi_windows.end() ? nullptr : it->second;
+}
 
-  if (last_valid != 0)
-    current_win = mpi_windows[last_valid - 1];
-  else
-    current_win = MPI_WIN_NULL;
+Kokkos::Impl::MPIWindow *MPISpace::find_allocation(const void *ptr,
+                                                   const char *&base) {
+  std::shared_lock<std::shared_timed_mutex> lock(mpi_windows_mutex);
+  // Only the last allocation starting at or before ptr can contain it
+  auto it = mpi_windows.upper_bound(ptr);
+  if (it == mpi_windows.begin()) return nullptr;
+  --it;
+  base = static_cast<const char *>(it->first);
+  return ptr < base + it->second->size ? it->second : nullptr;
 }
 
+MPI_Comm MPISpace::get_comm(const void *ptr) {
+  const char *base;
+  Kokkos::Impl::MPIWindow *window = find_allocation(ptr, base);
+  return window ? window->comm : MPI_COMM_WORLD;
+}
+
+// Completes the operations on all windows of this instance's communicator.
+// Only the ranks of that communicator synchronize.
 void MPISpace::fence() {
-  for (int i = 0; i < mpi_windows.size(); i++) {
-    if (mpi_windows[i] != MPI_WIN_NULL) {
-      MPI_Win_flush_all(mpi_windows[i]);
-    } else {
-      break;
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(mpi_windows_mutex);
+    for (auto &it : mpi_windows) {
+      if (it.second->comm != comm) continue;
+      it.second->flush_dirty();
+      it.second->sync();
     }
   }
-  MPI_Barrier(MPI_COMM_WORLD);
+  MPI_Barrier(comm);
+  std::lock_guard<std::shared_timed_mutex> lock(mpi_windows_mutex);
+  for (auto &it : mpi_windows) {
+    if (it.second->comm == comm) it.second->sync();
+  }
+  // Remote data may have changed since the cached lines were read
+  Kokkos::Impl::get_read_cache().invalidate();
 }
 
-size_t get_num_pes() {
-  int n_ranks;
-  MPI_Comm_size(MPI_COMM_WORLD, &n_ranks);
-  return n_ranks;
+size_t get_num_pes() { return get_num_pes(MPISpace()); }
+
+size_t get_my_pe() { return get_my_pe(MPISpace()); }
+
+size_t get_indexing_block_size(size_t size) {
+  return get_indexing_block_size(size, MPISpace());
 }
 
-size_t get_my_pe() {
-  int rank;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
-  return rank;
+std::pair<size_t, size_t> getRange(size_t size, size_t pe) {
+  return getRange(size, pe, MPISpace());
 }
 
-KOKKOS_FUNCTION
-size_t get_indexing_block_size(size_t size) {
+size_t get_num_pes(const MPISpace &space) { return space.impl_get_num_pes(); }
+
+size_t get_my_pe(const MPISpace &space) { return space.impl_get_my_pe(); }
+
+size_t get_indexing_block_size(size_t size, const MPISpace &space) {
   size_t num_pes, block;
-  num_pes = get_num_pes();
+  num_pes = get_num_pes(space);
   block   = (size + num_pes - 1) / num_pes;
   return block;
 }
 
-std::pair<size_t, size_t> getRange(size_t size, size_t pe) {
+std::pair<size_t, size_t> getRange(size_t size, size_t pe,
+                                   const MPISpace &space) {
   size_t start, end;
-  size_t block = get_indexing_block_size(size);
+  size_t block = get_indexing_block_size(size, space);
   start        = pe * block;
   end          = (pe + 1) * block;
 
-  size_t num_pes = get_num_pes();
+  size_t num_pes = get_num_pes(space);
 
   if (size < num_pes) {
     size_t diff = (num_pes * block) - size;
@@ -187,13 +546,17 @@ namespace Impl {
 
 Kokkos::Impl::DeepCopy<HostSpace, Kokkos::Experimental::MPISpace>::DeepCopy(
     void *dst, const void *src, size_t n) {
-  Kokkos::Experimental::MPISpace().fence();
+  Kokkos::Experimental::MPISpace(
+      Kokkos::Experimental::MPISpace::get_comm(src))
+      .fence();
   memcpy(dst, src, n);
 }
 
 Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace, HostSpace>::DeepCopy(
     void *dst, const void *src, size_t n) {
-  Kokkos::Experimental::MPISpace().fence();
+  Kokkos::Experimental::MPISpace(
+      Kokkos::Experimental::MPISpace::get_comm(dst))
+      .fence();
   memcpy((char *)dst, (char *)src, n);
 }
 
@@ -202,7 +565,9 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
                                                                  const void
                                                                      *src,
                                                                  size_t n) {
-  Kokkos::Experimental::MPISpace().fence();
+  Kokkos::Experimental::MPISpace(
+      Kokkos::Experimental::MPISpace::get_comm(dst))
+      .fence();
   memcpy(dst, src, n);
 }
 
@@ -211,7 +576,9 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
                        Kokkos::Experimental::MPISpace,
                        ExecutionSpace>::DeepCopy(void *dst, const void *src,
                                                  size_t n) {
-  Kokkos::Experimental::MPISpace().fence();
+  Kokkos::Experimental::MPISpace(
+      Kokkos::Experimental::MPISpace::get_comm(dst))
+      .fence();
   memcpy(dst, src, n);
 }
 
@@ -221,20 +588,57 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::MPISpace,
                        ExecutionSpace>::DeepCopy(const ExecutionSpace &exec,
                                                  void *dst, const void *src,
                                                  size_t n) {
-  Kokkos::Experimental::MPISpace().fence();
+  Kokkos::Experimental::MPISpace(
+      Kokkos::Experimental::MPISpace::get_comm(dst))
+      .fence();
   memcpy(dst, src, n);
 }
 
-// Currently not invoked. We need a better local_deep_copy overload that
-// recognizes consecutive memory regions
+namespace {
+
+// Window of the symmetric allocation containing ptr and the displacement of
+// ptr within that window
+MPIWindow *find_window(const void *ptr, MPI_Aint &disp) {
+  const char *base;
+  MPIWindow *window =
+      Kokkos::Experimental::MPISpace::find_allocation(ptr, base);
+  if (window && ptr >= base + sizeof(SharedAllocationHeader)) {
+    const char *data = base + sizeof(SharedAllocationHeader);
+    disp             = window->disp + (static_cast<const char *>(ptr) - data);
+    return window;
+  }
+  Kokkos::abort("MPISpace: address is not part of a symmetric allocation");
+  return nullptr;
+}
+
+}  // namespace
+
+// Bulk transfers of n bytes between local memory and the address of a
+// symmetric allocation on pe. They return once the transfer is complete
 void local_deep_copy_get(void *dst, const void *src, size_t pe, size_t n) {
-  // TBD
+  MPI_Aint disp;
+  MPIWindow *win         = find_window(src, disp);
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  char *bytes            = static_cast<char *>(dst);
+  for (size_t done = 0; done < n; done += max_chunk) {
+    const int chunk = static_cast<int>(std::min(max_chunk, n - done));
+    MPI_Get(bytes + done, chunk, MPI_BYTE, pe, disp + done, chunk, MPI_BYTE,
+            win->mpi_win);
+  }
+  MPI_Win_flush(pe, win->mpi_win);
 }
 
-// Currently not invoked. We need a better local_deep_copy overload that
-// recognizes consecutive memory regions
 void local_deep_copy_put(void *dst, const void *src, size_t pe, size_t n) {
-  // TBD
+  MPI_Aint disp;
+  MPIWindow *win         = find_window(dst, disp);
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  const char *bytes      = static_cast<const char *>(src);
+  for (size_t done = 0; done < n; done += max_chunk) {
+    const int chunk = static_cast<int>(std::min(max_chunk, n - done));
+    MPI_Put(bytes + done, chunk, MPI_BYTE, pe, disp + done, chunk, MPI_BYTE,
+            win->mpi_win);
+  }
+  MPI_Win_flush(pe, win->mpi_win);
 }
 
 }  // namespace Impl
@@ -54,11 +54,57 @@
 #include <Kokkos_Core.hpp>
 
 #include <Kokkos_RemoteSpaces.hpp>
+#include <atomic>
 #include <mpi.h>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <vector>
 /*--------------------------------------------------------------------------*/
 
 namespace Kokkos {
+namespace Impl {
+
+// RMA window of a symmetric allocation. Tracks the target ranks with
+// outstanding non-blocking operations such that completion only needs to
+// flush those targets.
+struct MPIWindow {
+  MPI_Win mpi_win;
+  // Communicator the window was created over and the allocation size
+  MPI_Comm comm;
+  size_t size;
+  // Displacement of the allocation's data within the window. Allocations
+  // from the symmetric arena alias the arena's windows (owns_windows false).
+  MPI_Aint disp;
+  bool owns_windows;
+  // Element reads go through the read cache (Cached allocation mode)
+  bool cached;
+  std::vector<std::atomic<uint64_t>> dirty;
+  // Node-local shared memory window and the base addresses of the segments
+  // of same-node ranks (indexed by rank, nullptr for off-node ranks)
+  MPI_Win shm_win;
+  std::vector<char *> node_ptrs;
+
+  MPIWindow(MPI_Win win_, MPI_Comm comm_, size_t size_,
+            MPI_Aint disp_ = sizeof(SharedAllocationHeader));
+
+  inline char *get_node_ptr(const int pe) const {
+    return node_ptrs.empty() ? nullptr : node_ptrs[pe];
+  }
+
+  inline void set_dirty(const int pe) {
+    std::atomic<uint64_t> &word = dirty[pe >> 6];
+    const uint64_t mask         = uint64_t(1) << (pe & 63);
+    if (!(word.load(std::memory_order_relaxed) & mask))
+      word.fetch_or(mask, std::memory_order_relaxed);
+  }
+
+  void flush_dirty();
+  void sync();
+};
+
+}  // namespace Impl
+
 namespace Experimental {
 
 struct RemoteSpaceSpecializeTag {};
@@ -110,9 +156,37 @@ class MPISpace {
   int *rank_list;
   int allocation_mode;
   int64_t extent;
-
-  static std::vector<MPI_Win> mpi_windows;
-  static MPI_Win current_win;
+  // Allocations, fences and PE numbering of this instance span comm only
+  MPI_Comm comm;
+
+  size_t impl_get_num_pes() const;
+  size_t impl_get_my_pe() const;
+
+  // Windows of all live symmetric allocations, ordered by allocation pointer.
+  // Lookups share the mutex, allocations and deallocations own it
+  static std::map<const void *, Kokkos::Impl::MPIWindow *> mpi_windows;
+  static std::shared_timed_mutex mpi_windows_mutex;
+
+  static Kokkos::Impl::MPIWindow *get_window(const void *arg_alloc_ptr);
+  // Window of the allocation containing ptr and the allocation pointer in
+  // base, or nullptr if ptr is not part of a symmetric allocation
+  static Kokkos::Impl::MPIWindow *find_allocation(const void *ptr,
+                                                  const char *&base);
+  // Communicator of the allocation containing ptr (MPI_COMM_WORLD if none)
+  static MPI_Comm get_comm(const void *ptr);
+
+  // Windows of released allocations are recycled if
+  // KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE is defined
+  struct WindowCacheStats {
+    size_t hits;
+    size_t misses;
+    size_t cached;
+  };
+  static WindowCacheStats get_window_cache_stats();
+
+  // Frees the cached windows of this instance's communicator. Collective over
+  // the communicator. Freeing the communicator releases them as well.
+  void impl_release_window_cache() const;
 
   void impl_set_allocation_mode(const int);
   void impl_set_extent(int64_t N);
@@ -123,11 +197,19 @@ class MPISpace {
       Kokkos::Experimental::MPISpace, void>;
 };
 
+// PE numbering over MPI_COMM_WORLD
 size_t get_num_pes();
 size_t get_my_pe();
 size_t get_indexing_block_size(size_t size);
 std::pair<size_t, size_t> getRange(size_t size, size_t pe);
 
+// PE numbering over the communicator of space
+size_t get_num_pes(const MPISpace &space);
+size_t get_my_pe(const MPISpace &space);
+size_t get_indexing_block_size(size_t size, const MPISpace &space);
+std::pair<size_t, size_t> getRange(size_t size, size_t pe,
+                                   const MPISpace &space);
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -157,6 +239,9 @@ struct DeepCopy<Kokkos::Experimental::MPISpace, Kokkos::Experimental::MPISpace,
   DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n);
 };
 
+void local_deep_copy_get(void *dst, const void *src, size_t pe, size_t n);
+void local_deep_copy_put(void *dst, const void *src, size_t pe, size_t n);
+
 template <>
 struct MemorySpaceAccess<Kokkos::Experimental::MPISpace,
                          Kokkos::Experimental::MPISpace> {
@@ -181,9 +266,15 @@ struct MemorySpaceAccess<Kokkos::HostSpace, Kokkos::Experimental::MPISpace> {
 #include <Kokkos_RemoteSpaces_Options.hpp>
 #include <Kokkos_RemoteSpaces_ViewOffset.hpp>
 #include <Kokkos_RemoteSpaces_ViewMapping.hpp>
+#include <Kokkos_RemoteSpaces_ReadCache.hpp>
 #include <Kokkos_MPISpace_Ops.hpp>
 #include <Kokkos_MPISpace_AllocationRecord.hpp>
 #include <Kokkos_MPISpace_DataHandle.hpp>
 #include <Kokkos_MPISpace_ViewTraits.hpp>
+#include <Kokkos_RemoteSpaces_Signal.hpp>
+#include <Kokkos_RemoteSpaces_LocalView.hpp>
+#include <Kokkos_RemoteSpaces_Halo.hpp>
+#include <Kokkos_RemoteSpaces_Gather.hpp>
+#include <Kokkos_RemoteSpaces_Scatter.hpp>
 
 #endif  // #define KOKKOS_MPISPACE_HPP
@@ -81,7 +81,7 @@ SharedAllocationRecord<Kokkos::Experimental::MPISpace, void>::
       static_cast<SharedAllocationRecord<void, void> *>(this);
   strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
           SharedAllocationHeader::maximum_label_length);
-  win = m_space.current_win;
+  win = Kokkos::Experimental::MPISpace::get_window(RecordBase::m_alloc_ptr);
 }
 
 SharedAllocationRecord<Kokkos::Experimental::MPISpace,
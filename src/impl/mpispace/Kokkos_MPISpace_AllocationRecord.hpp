@@ -80,7 +80,7 @@ class SharedAllocationRecord<Kokkos::Experimental::MPISpace, void>
  public:
   const Kokkos::Experimental::MPISpace m_space;
 
-  MPI_Win win;
+  MPIWindow *win;
 
   inline std::string get_label() const {
     return std::string(RecordBase::head()->m_label);
@@ -45,28 +45,48 @@
 #ifndef KOKKOS_REMOTESPACES_MPI_DATAHANDLE_HPP
 #define KOKKOS_REMOTESPACES_MPI_DATAHANDLE_HPP
 
+#include <algorithm>
+#include <limits>
+
 namespace Kokkos {
 namespace Impl {
 
 template <class T, class Traits>
 struct MPIDataHandle {
   T *ptr;
-  mutable MPI_Win win;
+  MPIWindow *win;
+  // Offset of ptr from the start of the allocation (non-zero for subviews)
+  size_t win_offset;
   KOKKOS_INLINE_FUNCTION
-  MPIDataHandle() : ptr(NULL), win(MPI_WIN_NULL) {}
+  MPIDataHandle() : ptr(NULL), win(nullptr), win_offset(0) {}
   KOKKOS_INLINE_FUNCTION
-  MPIDataHandle(T *ptr_, MPI_Win &win_) : ptr(ptr_), win(win_) {}
+  MPIDataHandle(T *ptr_, MPIWindow *win_, size_t win_offset_ = 0)
+      : ptr(ptr_), win(win_), win_offset(win_offset_) {}
   KOKKOS_INLINE_FUNCTION
   MPIDataHandle(MPIDataHandle<T, Traits> const &arg)
-      : ptr(arg.ptr), win(arg.win) {}
+      : ptr(arg.ptr), win(arg.win), win_offset(arg.win_offset) {}
   KOKKOS_INLINE_FUNCTION
-  MPIDataHandle(T *ptr_) : ptr(ptr_), win(MPI_WIN_NULL) {}
+  MPIDataHandle(T *ptr_) : ptr(ptr_), win(nullptr), win_offset(0) {}
 
   template <typename iType>
   KOKKOS_INLINE_FUNCTION MPIDataElement<T, Traits> operator()(
       const int &pe, const iType &i) const {
-    assert(win != MPI_WIN_NULL);
-    MPIDataElement<T, Traits> element(&win, pe, i);
+    assert(win != nullptr);
+    // Same-node peers are accessed directly if node-local shared windows
+    // are enabled
+    char *node_ptr = win->get_node_ptr(pe);
+    T *direct_ptr =
+        node_ptr ? reinterpret_cast<T *>(node_ptr + win->disp) + win_offset + i
+                 : nullptr;
+    MPIDataElement<T, Traits> element(win, pe, win_offset + i, direct_ptr);
+    return element;
+  }
+
+  // Element of the calling PE's own allocation
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION MPIDataElement<T, Traits> local(const int &pe,
+                                                         const iType &i) const {
+    MPIDataElement<T, Traits> element(win, pe, win_offset + i, ptr + i);
     return element;
   }
 
@@ -96,12 +116,165 @@ struct ViewDataHandle<
   template <class SrcHandleType>
   KOKKOS_INLINE_FUNCTION static handle_type assign(
       SrcHandleType const arg_data_ptr, size_t offset) {
-    // FIXME: Invocation of handle_type constructor sets win to MPI_WIN_NULL
-    // This is invoked by subview ViewMapping so subviews will likely fail
-    return handle_type(arg_data_ptr + offset);
+    return handle_type(arg_data_ptr + offset, arg_data_ptr.win,
+                       arg_data_ptr.win_offset + offset);
   }
 };
 
+// Puts n elements from src to dst on pe and then sets the signal sig on pe.
+// The flush completes the data at the target before the signal is written
+template <class T, class Traits, class SigTraits>
+inline void put_signal(const MPIDataHandle<T, Traits> &dst, const T *src,
+                       size_t n, const MPIDataHandle<uint64_t, SigTraits> &sig,
+                       uint64_t value, int pe) {
+  assert(dst.win != nullptr && sig.win != nullptr);
+  // MPI counts are int, so large transfers are issued in chunks
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  const char *bytes      = reinterpret_cast<const char *>(src);
+  const size_t nbytes    = n * sizeof(T);
+  const MPI_Aint disp    = dst.win->disp + dst.win_offset * sizeof(T);
+  for (size_t done = 0; done < nbytes; done += max_chunk) {
+    const int chunk = static_cast<int>(std::min(max_chunk, nbytes - done));
+    MPI_Put(bytes + done, chunk, MPI_BYTE, pe, disp + done, chunk, MPI_BYTE,
+            dst.win->mpi_win);
+  }
+  MPI_Win_flush(pe, dst.win->mpi_win);
+  MPI_Accumulate(&value, 1, MPI_UINT64_T, pe,
+                 sig.win->disp + sig.win_offset * sizeof(uint64_t), 1,
+                 MPI_UINT64_T, MPI_REPLACE, sig.win->mpi_win);
+  MPI_Win_flush(pe, sig.win->mpi_win);
+}
+
+// Waits until the local signal sig is at least value by polling it with
+// atomic reads
+template <class Traits>
+inline void signal_wait_until(const MPIDataHandle<uint64_t, Traits> &sig,
+                              uint64_t value) {
+  assert(sig.win != nullptr);
+  int pe;
+  MPI_Comm_rank(sig.win->comm, &pe);
+  const MPI_Aint disp = sig.win->disp + sig.win_offset * sizeof(uint64_t);
+  uint64_t current;
+  do {
+    MPI_Fetch_and_op(nullptr, &current, MPI_UINT64_T, pe, disp, MPI_NO_OP,
+                     sig.win->mpi_win);
+    MPI_Win_flush(pe, sig.win->mpi_win);
+  } while (current < value);
+  // Make the signaled data visible to local loads
+  MPI_Win_sync(sig.win->mpi_win);
+}
+
+// Starts a get of n elements at offset in src on pe into dst. The get is
+// completed by the next fence of the memory space
+template <class T, class Traits>
+inline void get_nbi(T *dst, const MPIDataHandle<T, Traits> &src,
+                    size_t offset, size_t n, int pe) {
+  assert(src.win != nullptr);
+  // MPI counts are int, so large transfers are issued in chunks
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  char *bytes            = reinterpret_cast<char *>(dst);
+  const size_t nbytes    = n * sizeof(T);
+  const MPI_Aint disp =
+      src.win->disp + (src.win_offset + offset) * sizeof(T);
+  for (size_t done = 0; done < nbytes; done += max_chunk) {
+    const int chunk = static_cast<int>(std::min(max_chunk, nbytes - done));
+    MPI_Get(bytes + done, chunk, MPI_BYTE, pe, disp + done, chunk, MPI_BYTE,
+            src.win->mpi_win);
+  }
+  src.win->set_dirty(pe);
+}
+
+// Starts a put of n elements from src to offset in dst on pe. The put is
+// completed by the next fence of the memory space
+template <class T, class Traits>
+inline void put_nbi(const MPIDataHandle<T, Traits> &dst, size_t offset,
+                    const T *src, size_t n, int pe) {
+  assert(dst.win != nullptr);
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  const char *bytes      = reinterpret_cast<const char *>(src);
+  const size_t nbytes    = n * sizeof(T);
+  const MPI_Aint disp =
+      dst.win->disp + (dst.win_offset + offset) * sizeof(T);
+  for (size_t done = 0; done < nbytes; done += max_chunk) {
+    const int chunk = static_cast<int>(std::min(max_chunk, nbytes - done));
+    MPI_Put(bytes + done, chunk, MPI_BYTE, pe, disp + done, chunk, MPI_BYTE,
+            dst.win->mpi_win);
+  }
+  dst.win->set_dirty(pe);
+}
+
+// Gets n elements at offset in src on pe into dst and waits for completion
+template <class T, class Traits>
+inline void get_bulk(T *dst, const MPIDataHandle<T, Traits> &src,
+                     size_t offset, size_t n, int pe) {
+  get_nbi(dst, src, offset, n, pe);
+  MPI_Win_flush(pe, src.win->mpi_win);
+}
+
+// Puts n elements from src to offset in dst on pe and waits for completion
+template <class T, class Traits>
+inline void put_bulk(const MPIDataHandle<T, Traits> &dst, size_t offset,
+                     const T *src, size_t n, int pe) {
+  put_nbi(dst, offset, src, n, pe);
+  MPI_Win_flush(pe, dst.win->mpi_win);
+}
+
+// Datatype of n elements of T spaced stride elements apart
+template <class T>
+inline MPI_Datatype mpi_strided_type(int n, ptrdiff_t stride) {
+  MPI_Datatype type;
+  MPI_Type_create_hvector(n, sizeof(T), stride * sizeof(T), MPI_BYTE, &type);
+  MPI_Type_commit(&type);
+  return type;
+}
+
+// Gets n elements spaced src_stride apart at offset in src on pe into dst,
+// spaced dst_stride apart, and waits for completion. Strides count elements
+template <class T, class Traits>
+inline void get_strided(T *dst, ptrdiff_t dst_stride,
+                        const MPIDataHandle<T, Traits> &src, size_t offset,
+                        ptrdiff_t src_stride, size_t n, int pe) {
+  assert(src.win != nullptr);
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  const MPI_Aint disp =
+      src.win->disp + (src.win_offset + offset) * sizeof(T);
+  for (size_t done = 0; done < n; done += max_chunk) {
+    const int chunk          = static_cast<int>(std::min(max_chunk, n - done));
+    MPI_Datatype origin_type = mpi_strided_type<T>(chunk, dst_stride);
+    MPI_Datatype target_type = mpi_strided_type<T>(chunk, src_stride);
+    MPI_Get(dst + done * dst_stride, 1, origin_type, pe,
+            disp + done * src_stride * sizeof(T), 1, target_type,
+            src.win->mpi_win);
+    // Pending operations keep freed datatypes alive
+    MPI_Type_free(&origin_type);
+    MPI_Type_free(&target_type);
+  }
+  MPI_Win_flush(pe, src.win->mpi_win);
+}
+
+// Puts n elements spaced src_stride apart from src to offset in dst on pe,
+// spaced dst_stride apart, and waits for completion
+template <class T, class Traits>
+inline void put_strided(const MPIDataHandle<T, Traits> &dst, size_t offset,
+                        ptrdiff_t dst_stride, const T *src,
+                        ptrdiff_t src_stride, size_t n, int pe) {
+  assert(dst.win != nullptr);
+  const size_t max_chunk = std::numeric_limits<int>::max();
+  const MPI_Aint disp =
+      dst.win->disp + (dst.win_offset + offset) * sizeof(T);
+  for (size_t done = 0; done < n; done += max_chunk) {
+    const int chunk          = static_cast<int>(std::min(max_chunk, n - done));
+    MPI_Datatype origin_type = mpi_strided_type<T>(chunk, src_stride);
+    MPI_Datatype target_type = mpi_strided_type<T>(chunk, dst_stride);
+    MPI_Put(src + done * src_stride, 1, origin_type, pe,
+            disp + done * dst_stride * sizeof(T), 1, target_type,
+            dst.win->mpi_win);
+    MPI_Type_free(&origin_type);
+    MPI_Type_free(&target_type);
+  }
+  MPI_Win_flush(pe, dst.win->mpi_win);
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
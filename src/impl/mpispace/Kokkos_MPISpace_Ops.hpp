@@ -45,23 +45,20 @@
 #ifndef KOKKOS_REMOTESPACES_MPI_OPS_HPP
 #define KOKKOS_REMOTESPACES_MPI_OPS_HPP
 
+#include <cstring>
 #include <type_traits>
 
 namespace Kokkos {
 namespace Impl {
 
-#define KOKKOS_REMOTESPACES_P(type, mpi_type)                                  \
-  static KOKKOS_INLINE_FUNCTION void mpi_type_p(                               \
-      const type val, const size_t offset, const int pe, const MPI_Win &win) { \
-    assert(win != MPI_WIN_NULL);                                               \
-    int _typesize;                                                             \
-    MPI_Type_size(mpi_type, &_typesize);                                       \
-    /*MPI_Win_lock(MPI_LOCK_SHARED, pe, 0, win); */                            \
-    MPI_Put(&val, 1, mpi_type, pe,                                             \
-            sizeof(SharedAllocationHeader) + offset * _typesize, 1, mpi_type,  \
-            win);                                                              \
-    /* MPI_Win_unlock(pe, win);  */                                            \
-    MPI_Win_flush(0, win);                                                     \
+#define KOKKOS_REMOTESPACES_P(type, mpi_type)                           \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_p(                        \
+      const type val, const size_t offset, const int pe,                \
+      const MPIWindow &win) {                                           \
+    assert(win.mpi_win != MPI_WIN_NULL);                                \
+    MPI_Put(&val, 1, mpi_type, pe, win.disp + offset * sizeof(type), 1, \
+            mpi_type, win.mpi_win);                                     \
+    MPI_Win_flush(pe, win.mpi_win);                                     \
   }
 
 KOKKOS_REMOTESPACES_P(char, MPI_SIGNED_CHAR)
@@ -79,18 +76,40 @@ KOKKOS_REMOTESPACES_P(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_P
 
-#define KOKKOS_REMOTESPACES_G(type, mpi_type)                                 \
-  static KOKKOS_INLINE_FUNCTION void mpi_type_g(                              \
-      type &val, const size_t offset, const int pe, const MPI_Win &win) {     \
-    assert(win != MPI_WIN_NULL);                                              \
-    int _typesize;                                                            \
-    MPI_Type_size(mpi_type, &_typesize);                                      \
-    /*MPI_Win_lock(MPI_LOCK_SHARED, 0, pe, win);*/                            \
-    MPI_Get(&val, 1, mpi_type, pe,                                            \
-            sizeof(SharedAllocationHeader) + offset * _typesize, 1, mpi_type, \
-            win);                                                             \
-    /*MPI_Win_unlock(0, win);*/                                               \
-    MPI_Win_flush(0, win);                                                    \
+// Non-blocking put: only local completion is enforced such that the origin
+// buffer can be released. Remote completion happens in MPISpace::fence.
+#define KOKKOS_REMOTESPACES_P_NBI(type, mpi_type)                          \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_p_nbi(                       \
+      const type val, const size_t offset, const int pe, MPIWindow &win) { \
+    assert(win.mpi_win != MPI_WIN_NULL);                                   \
+    MPI_Put(&val, 1, mpi_type, pe, win.disp + offset * sizeof(type), 1,    \
+            mpi_type, win.mpi_win);                                        \
+    MPI_Win_flush_local(pe, win.mpi_win);                                  \
+    win.set_dirty(pe);                                                     \
+  }
+
+KOKKOS_REMOTESPACES_P_NBI(char, MPI_SIGNED_CHAR)
+KOKKOS_REMOTESPACES_P_NBI(unsigned char, MPI_UNSIGNED_CHAR)
+KOKKOS_REMOTESPACES_P_NBI(short, MPI_SHORT)
+KOKKOS_REMOTESPACES_P_NBI(unsigned short, MPI_UNSIGNED_SHORT)
+KOKKOS_REMOTESPACES_P_NBI(int, MPI_INT)
+KOKKOS_REMOTESPACES_P_NBI(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_P_NBI(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_P_NBI(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_P_NBI(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_P_NBI(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_P_NBI(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_P_NBI(double, MPI_DOUBLE)
+
+#undef KOKKOS_REMOTESPACES_P_NBI
+
+#define KOKKOS_REMOTESPACES_G(type, mpi_type)                               \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_g(                            \
+      type &val, const size_t offset, const int pe, const MPIWindow &win) { \
+    assert(win.mpi_win != MPI_WIN_NULL);                                    \
+    MPI_Get(&val, 1, mpi_type, pe, win.disp + offset * sizeof(type), 1,     \
+            mpi_type, win.mpi_win);                                         \
+    MPI_Win_flush(pe, win.mpi_win);                                         \
   }
 
 KOKKOS_REMOTESPACES_G(char, MPI_SIGNED_CHAR)
@@ -107,99 +126,180 @@ KOKKOS_REMOTESPACES_G(float, MPI_FLOAT)
 KOKKOS_REMOTESPACES_G(double, MPI_DOUBLE)
 #undef KOKKOS_REMOTESPACES_G
 
-#define KOKKOS_REMOTESPACES_ATOMIC_SET(type)                                   \
-  static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_set(type *ptr,            \
-                                                         type value, int pe) { \
-    /* TBD */                                                                  \
-  }
-
-KOKKOS_REMOTESPACES_ATOMIC_SET(int)
-KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned int)
-KOKKOS_REMOTESPACES_ATOMIC_SET(long)
-KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long)
-KOKKOS_REMOTESPACES_ATOMIC_SET(long long)
-KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long long)
-KOKKOS_REMOTESPACES_ATOMIC_SET(float)
-KOKKOS_REMOTESPACES_ATOMIC_SET(double)
+// Reads val through the read cache. A miss gets the whole cache line
+template <class T>
+static inline void mpi_type_g_cached(T &val, const size_t offset, const int pe,
+                                     const MPIWindow &win) {
+  assert(win.mpi_win != MPI_WIN_NULL);
+  const size_t size = win.size - sizeof(SharedAllocationHeader);
+  get_read_cache().read(&val, &win, pe, offset * sizeof(T), sizeof(T), size,
+                        [&](char *dst, size_t pos, size_t n) {
+                          MPI_Get(dst, int(n), MPI_BYTE, pe, win.disp + pos,
+                                  int(n), MPI_BYTE, win.mpi_win);
+                          MPI_Win_flush(pe, win.mpi_win);
+                        });
+}
+
+#define KOKKOS_REMOTESPACES_ATOMIC_SET(type, mpi_type)                         \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_set(                      \
+      const type val, const size_t offset, const int pe,                       \
+      const MPIWindow &win) {                                                  \
+    assert(win.mpi_win != MPI_WIN_NULL);                                       \
+    MPI_Accumulate(&val, 1, mpi_type, pe, win.disp + offset * sizeof(type), 1, \
+                   mpi_type, MPI_REPLACE, win.mpi_win);                        \
+    MPI_Win_flush(pe, win.mpi_win);                                            \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_SET(int, MPI_INT)
+KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_ATOMIC_SET(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_SET(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_SET(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_ATOMIC_SET(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_SET
 
-#define KOKKOS_REMOTESPACES_ATOMIC_FETCH(type)                        \
-  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_fetch(type *ptr, \
-                                                           int pe) {  \
-    /* TBD */                                                         \
-    return 0;                                                         \
-  }
-
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(int)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned int)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(long long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(float)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(double)
+#define KOKKOS_REMOTESPACES_ATOMIC_FETCH(type, mpi_type)                    \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_fetch(                 \
+      type &val, const size_t offset, const int pe, const MPIWindow &win) { \
+    assert(win.mpi_win != MPI_WIN_NULL);                                    \
+    MPI_Fetch_and_op(NULL, &val, mpi_type, pe,                              \
+                     win.disp + offset * sizeof(type), MPI_NO_OP,           \
+                     win.mpi_win);                                          \
+    MPI_Win_flush(pe, win.mpi_win);                                         \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(int, MPI_INT)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_FETCH
 
-#define KOKKOS_REMOTESPACES_ATOMIC_ADD(type)                                   \
-  static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_add(type *ptr,            \
-                                                         type value, int pe) { \
-    /* TBD */                                                                  \
-  }
-
-KOKKOS_REMOTESPACES_ATOMIC_ADD(int)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned int)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(long)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(long long)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long long)
+#define KOKKOS_REMOTESPACES_ATOMIC_ADD(type, mpi_type)                         \
+  static KOKKOS_INLINE_FUNCTION void mpi_type_atomic_add(                      \
+      const type val, const size_t offset, const int pe,                       \
+      const MPIWindow &win) {                                                  \
+    assert(win.mpi_win != MPI_WIN_NULL);                                       \
+    MPI_Accumulate(&val, 1, mpi_type, pe, win.disp + offset * sizeof(type), 1, \
+                   mpi_type, MPI_SUM, win.mpi_win);                            \
+    MPI_Win_flush(pe, win.mpi_win);                                            \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_ADD(int, MPI_INT)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_ADD
 
-#define KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(type)              \
-  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_fetch_add( \
-      type *ptr, type value, int pe) {                          \
-    /* TBD */                                                   \
-    return 0;                                                   \
-  }
-
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(int)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned int)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long long)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long long)
+#define KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(type, mpi_type)                  \
+  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_fetch_add(               \
+      const type val, const size_t offset, const int pe,                      \
+      const MPIWindow &win) {                                                 \
+    assert(win.mpi_win != MPI_WIN_NULL);                                      \
+    type ret;                                                                 \
+    MPI_Fetch_and_op(&val, &ret, mpi_type, pe,                                \
+                     win.disp + offset * sizeof(type), MPI_SUM, win.mpi_win); \
+    MPI_Win_flush(pe, win.mpi_win);                                           \
+    return ret;                                                               \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(int, MPI_INT)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD
 
-#define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(type)              \
-  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_compare_swap( \
-      type *ptr, type cond, type value, int pe) {                  \
-    /* TBD */                                                      \
-    return 0;                                                      \
-  }
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(int)
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned int)
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long)
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long)
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long long)
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long long)
+// MPI_Compare_and_swap is restricted to integer, logical and byte types
+#define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(type, mpi_type)           \
+  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_compare_swap(        \
+      const type cond, const type val, const size_t offset, const int pe, \
+      const MPIWindow &win) {                                             \
+    assert(win.mpi_win != MPI_WIN_NULL);                                  \
+    type ret;                                                             \
+    MPI_Compare_and_swap(&val, &cond, &ret, mpi_type, pe,                 \
+                         win.disp + offset * sizeof(type), win.mpi_win);  \
+    MPI_Win_flush(pe, win.mpi_win);                                       \
+    return ret;                                                           \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(int, MPI_INT)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long long,
+                                        MPI_UNSIGNED_LONG_LONG)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP
 
-#define KOKKOS_REMOTESPACES_ATOMIC_SWAP(type)              \
-  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_swap( \
-      type *ptr, type value, int pe) {                     \
-    /* TBD */                                              \
-    return 0;                                              \
-  }
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(int)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned int)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(long)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(long long)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long long)
+// Floating-point values are compared and swapped as the bits of an integer
+// of the same size
+#define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP_BITS(type, int_type)      \
+  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_compare_swap(        \
+      const type cond, const type val, const size_t offset, const int pe, \
+      const MPIWindow &win) {                                             \
+    static_assert(sizeof(type) == sizeof(int_type),                       \
+                  "compare and swap requires an integer of equal size");  \
+    int_type int_cond, int_val, int_ret;                                  \
+    std::memcpy(&int_cond, &cond, sizeof(type));                          \
+    std::memcpy(&int_val, &val, sizeof(type));                            \
+    int_ret = mpi_type_atomic_compare_swap(int_cond, int_val, offset, pe, \
+                                           win);                          \
+    type ret;                                                             \
+    std::memcpy(&ret, &int_ret, sizeof(type));                            \
+    return ret;                                                           \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP_BITS(float, unsigned int)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP_BITS(double, unsigned long long)
+
+#undef KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP_BITS
+
+// Compare-and-swap loops end once the swap saw the expected bits. Comparing
+// values instead would never end for NaN
+template <class T>
+static KOKKOS_INLINE_FUNCTION bool mpi_same_bits(const T &a, const T &b) {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+#define KOKKOS_REMOTESPACES_ATOMIC_SWAP(type, mpi_type)             \
+  static KOKKOS_INLINE_FUNCTION type mpi_type_atomic_swap(          \
+      const type val, const size_t offset, const int pe,            \
+      const MPIWindow &win) {                                       \
+    assert(win.mpi_win != MPI_WIN_NULL);                            \
+    type ret;                                                       \
+    MPI_Fetch_and_op(&val, &ret, mpi_type, pe,                      \
+                     win.disp + offset * sizeof(type), MPI_REPLACE, \
+                     win.mpi_win);                                  \
+    MPI_Win_flush(pe, win.mpi_win);                                 \
+    return ret;                                                     \
+  }
+
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(int, MPI_INT)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned int, MPI_UNSIGNED)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(long, MPI_INT64_T)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long, MPI_UNSIGNED_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(long long, MPI_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long long, MPI_UNSIGNED_LONG_LONG)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(float, MPI_FLOAT)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(double, MPI_DOUBLE)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_SWAP
 
@@ -210,309 +310,320 @@ struct MPIDataElement {};
 template <class T, class Traits>
 struct MPIDataElement<
     T, Traits,
-    typename std::enable_if<!Traits::memory_traits::is_atomic>::type> {
+    typename std::enable_if<Traits::memory_traits::is_atomic>::type> {
   typedef const T const_value_type;
   typedef T non_const_value_type;
-  const MPI_Win *win;
-  int offset;
+  MPIWindow *win;
+  size_t offset;
   int pe;
 
+  // Atomics are always issued through the window, even if the element is
+  // directly accessible, as MPI does not guarantee atomicity with respect to
+  // processor atomics
   KOKKOS_INLINE_FUNCTION
-  MPIDataElement(MPI_Win *win_, int pe_, int i_)
+  MPIDataElement(MPIWindow *win_, int pe_, size_t i_, T * = nullptr)
       : win(win_), offset(i_), pe(pe_) {}
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
-    mpi_type_p(val, offset, pe, *win);
+    mpi_type_atomic_set(val, offset, pe, *win);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   void inc() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
-    val++;
-    mpi_type_p(val, offset, pe, *win);
+    T tmp;
+    tmp = 1;
+    mpi_type_atomic_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
-    val--;
-    mpi_type_p(val, offset, pe, *win);
+    T tmp;
+    tmp = 0 - 1;
+    mpi_type_atomic_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
-    val++;
-    mpi_type_p(val, offset, pe, *win);
-    return val;
+    T tmp;
+    tmp = 1;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
-    val--;
-    mpi_type_p(val, offset, pe, *win);
-    return val;
+    T tmp;
+    tmp = 0 - 1;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
-    val++;
-    mpi_type_p(val, offset, pe, *win);
-    return val;
+    T tmp;
+    tmp = 1;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
-    val--;
-    mpi_type_p(val, offset, pe, *win);
-    return val;
+    T tmp;
+    tmp = 0 - 1;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp += val;
-    mpi_type_p(tmp, offset, pe, *win);
-    return tmp;
+    return mpi_type_atomic_fetch_add(val, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp -= val;
-    mpi_type_p(tmp, offset, pe, *win);
-    return tmp;
+    T tmp;
+    tmp = 0 - val;
+    return mpi_type_atomic_fetch_add(tmp, offset, pe, *win);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp *= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp * val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp /= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp / val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp %= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp % val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp &= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp & val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp ^= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp ^ val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp |= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp | val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp <<= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp << val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
-    tmp >>= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    T oldval, newval, tmp;
+    mpi_type_atomic_fetch(oldval, offset, pe, *win);
+    do {
+      tmp    = oldval;
+      newval = tmp >> val;
+      oldval = mpi_type_atomic_compare_swap(tmp, newval, offset, pe, *win);
+    } while (!mpi_same_bits(tmp, oldval));
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp - val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp * val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp / val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp % val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator!() const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return !tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&&(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp && val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator||(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp || val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp & val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp | val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp ^ val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator~() const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return ~tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<(const unsigned int &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp << val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>(const unsigned int &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp >> val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator==(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp == val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator!=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp != val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp >= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp <= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp < val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp > val;
   }
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp;
+    mpi_type_atomic_fetch(tmp, offset, pe, *win);
     return tmp;
   }
 };
@@ -521,309 +632,299 @@ struct MPIDataElement<
 template <class T, class Traits>
 struct MPIDataElement<
     T, Traits,
-    typename std::enable_if<Traits::memory_traits::is_atomic>::type> {
+    typename std::enable_if<!Traits::memory_traits::is_atomic>::type> {
   typedef const T const_value_type;
   typedef T non_const_value_type;
-  const MPI_Win *win;
-  int offset;
+  MPIWindow *win;
+  size_t offset;
   int pe;
+  // Element address if directly accessible through load/store, else nullptr
+  T *ptr;
 
   KOKKOS_INLINE_FUNCTION
-  MPIDataElement(MPI_Win *win_, int pe_, int i_)
-      : win(win_), offset(i_), pe(pe_) {}
+  MPIDataElement(MPIWindow *win_, int pe_, size_t i_, T *ptr_ = nullptr)
+      : win(win_), offset(i_), pe(pe_), ptr(ptr_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  T get() const {
+    if (ptr) return *ptr;
+    T val = T();
+    if (win->cached)
+      mpi_type_g_cached(val, offset, pe, *win);
+    else
+      mpi_type_g(val, offset, pe, *win);
+    return val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void put(const T &val) const {
+    // Drop the cached copy so later reads of this PE see the new value
+    if (!ptr && win->cached)
+      get_read_cache().forget(win, pe, offset * sizeof(T), sizeof(T));
+    if (ptr)
+      *ptr = val;
+    else if (RemoteSpaces_MemoryTraits<
+                 typename Traits::memory_traits>::is_nonblocking)
+      mpi_type_p_nbi(val, offset, pe, *win);
+    else
+      mpi_type_p(val, offset, pe, *win);
+  }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   void inc() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    T val = get();
     val++;
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    T val = get();
     val--;
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    T val = get();
     val++;
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    T val = get();
     val--;
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    T val = get();
     val++;
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
-    T val = T();
-    mpi_type_g(val, offset, pe, *win);
+    T val = get();
     val--;
-    mpi_type_p(val, offset, pe, *win);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp += val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp -= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp *= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp /= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp %= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp &= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp ^= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp |= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp <<= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     tmp >>= val;
-    mpi_type_p(tmp, offset, pe, *win);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp - val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp * val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp / val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp % val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator!() const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return !tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&&(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp && val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator||(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp || val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp & val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp | val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp ^ val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator~() const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return ~tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<(const unsigned int &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp << val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>(const unsigned int &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp >> val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator==(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp == val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator!=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp != val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp >= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<=(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp <= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp < val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>(const_value_type &val) const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp > val;
   }
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
-    T tmp = T();
-    mpi_type_g(tmp, offset, pe, *win);
+    T tmp = get();
     return tmp;
   }
 };
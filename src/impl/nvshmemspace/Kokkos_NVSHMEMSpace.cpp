@@ -44,11 +44,36 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_NVSHMEMSpace.hpp>
+#include <Kokkos_RemoteSpaces_SymmetricArena.hpp>
 #include <nvshmem.h>
 
 namespace Kokkos {
 namespace Experimental {
 
+namespace {
+
+// Symmetric arena serving all allocations, reserved by the first allocation
+// if KOKKOS_REMOTE_SPACES_ARENA_SIZE is set
+Kokkos::Impl::SymmetricArena *get_arena() {
+  static Kokkos::Impl::SymmetricArena *arena =
+      []() -> Kokkos::Impl::SymmetricArena * {
+    const size_t size = Kokkos::Impl::get_symmetric_arena_size();
+    if (!size) return nullptr;
+    void *base = nvshmem_malloc(size);
+    if (!base) Kokkos::abort("NVSHMEMSpace arena allocation failed.");
+    Kokkos::Impl::SymmetricArena *a = new Kokkos::Impl::SymmetricArena(
+        base, size, Kokkos::Impl::MEMORY_ALIGNMENT);
+    Kokkos::push_finalize_hook([a]() {
+      nvshmem_free(a->get_base());
+      delete a;
+    });
+    return a;
+  }();
+  return arena;
+}
+
+}  // namespace
+
 /* Default allocation mechanism */
 NVSHMEMSpace::NVSHMEMSpace()
     : allocation_mode(Kokkos::Experimental::Symmetric) {}
@@ -59,6 +84,10 @@ void NVSHMEMSpace::impl_set_allocation_mode(const int allocation_mode_) {
 
 void NVSHMEMSpace::impl_set_extent(const int64_t extent_) { extent = extent_; }
 
+size_t NVSHMEMSpace::impl_get_num_pes() const { return get_num_pes(); }
+
+size_t NVSHMEMSpace::impl_get_my_pe() const { return get_my_pe(); }
+
 void *NVSHMEMSpace::allocate(const size_t arg_alloc_size) const {
   static_assert(sizeof(void *) == sizeof(uintptr_t),
                 "Error sizeof(void*) != sizeof(uintptr_t)");
@@ -72,7 +101,13 @@ void *NVSHMEMSpace::allocate(const size_t arg_alloc_size) const {
     if (allocation_mode == Kokkos::Experimental::Symmetric) {
       int num_pes = nvshmem_n_pes();
       int my_id   = nvshmem_my_pe();
-      ptr         = nvshmem_malloc(arg_alloc_size);
+      if (Kokkos::Impl::SymmetricArena *arena = get_arena())
+        ptr = arena->allocate(arg_alloc_size);
+      // Arena blocks skip the barrier of the symmetric allocation, which
+      // keeps PEs from reusing memory that others still access
+      if (ptr) nvshmem_barrier_all();
+      // Fall back to a dedicated allocation once the arena is exhausted
+      if (!ptr) ptr = nvshmem_malloc(arg_alloc_size);
     } else {
       Kokkos::abort("NVSHMEMSpace only supports symmetric allocation policy.");
     }
@@ -81,6 +116,8 @@ void *NVSHMEMSpace::allocate(const size_t arg_alloc_size) const {
 }
 
 void NVSHMEMSpace::deallocate(void *const arg_alloc_ptr, const size_t) const {
+  Kokkos::Impl::SymmetricArena *arena = get_arena();
+  if (arena && arena->deallocate(arg_alloc_ptr)) return;
   nvshmem_free(arg_alloc_ptr);
 }
 
@@ -124,6 +161,22 @@ std::pair<size_t, size_t> getRange(size_t size, size_t pe) {
   return std::make_pair(start, end);
 }
 
+KOKKOS_FUNCTION
+size_t get_num_pes(const NVSHMEMSpace &) { return get_num_pes(); }
+
+KOKKOS_FUNCTION
+size_t get_my_pe(const NVSHMEMSpace &) { return get_my_pe(); }
+
+KOKKOS_FUNCTION
+size_t get_indexing_block_size(size_t size, const NVSHMEMSpace &) {
+  return get_indexing_block_size(size);
+}
+
+std::pair<size_t, size_t> getRange(size_t size, size_t pe,
+                                   const NVSHMEMSpace &) {
+  return getRange(size, pe);
+}
+
 }  // namespace Experimental
 
 namespace Impl {
@@ -159,16 +212,14 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::NVSHMEMSpace,
   cudaMemcpy(dst, src, n, cudaMemcpyDefault);
 }
 
-// Currently not invoked. We need a better local_deep_copy overload that
-// recognizes consecutive memory regions
+// Bulk transfers of n bytes between local memory and the address of a
+// symmetric allocation on pe
 void local_deep_copy_get(void *dst, const void *src, size_t pe, size_t n) {
-  nvshmem_getmem(dst, src, pe, n);
+  nvshmem_getmem(dst, src, n, pe);
 }
 
-// Currently not invoked. We need a better local_deep_copy overload that
-// recognizes consecutive memory regions
 void local_deep_copy_put(void *dst, const void *src, size_t pe, size_t n) {
-  nvshmem_putmem(dst, src, pe, n);
+  nvshmem_putmem(dst, src, n, pe);
 }
 
 }  // namespace Impl
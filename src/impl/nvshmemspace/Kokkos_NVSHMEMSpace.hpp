@@ -112,6 +112,9 @@ class NVSHMEMSpace {
   int allocation_mode;
   int64_t extent;
 
+  size_t impl_get_num_pes() const;
+  size_t impl_get_my_pe() const;
+
   void impl_set_allocation_mode(const int);
   void impl_set_extent(int64_t N);
 
@@ -129,6 +132,16 @@ KOKKOS_FUNCTION
 size_t get_indexing_block_size(size_t size);
 std::pair<size_t, size_t> getRange(size_t size, size_t pe);
 
+// All PEs take part in every NVSHMEMSpace instance
+KOKKOS_FUNCTION
+size_t get_num_pes(const NVSHMEMSpace &space);
+KOKKOS_FUNCTION
+size_t get_my_pe(const NVSHMEMSpace &space);
+KOKKOS_FUNCTION
+size_t get_indexing_block_size(size_t size, const NVSHMEMSpace &space);
+std::pair<size_t, size_t> getRange(size_t size, size_t pe,
+                                   const NVSHMEMSpace &space);
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -152,6 +165,9 @@ struct DeepCopy<Kokkos::Experimental::NVSHMEMSpace,
   DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n);
 };
 
+void local_deep_copy_get(void *dst, const void *src, size_t pe, size_t n);
+void local_deep_copy_put(void *dst, const void *src, size_t pe, size_t n);
+
 template <>
 struct MemorySpaceAccess<Kokkos::Experimental::NVSHMEMSpace,
                          Kokkos::Experimental::NVSHMEMSpace> {
@@ -189,5 +205,10 @@ struct MemorySpaceAccess<Kokkos::CudaSpace,
 #include <Kokkos_NVSHMEMSpace_AllocationRecord.hpp>
 #include <Kokkos_NVSHMEMSpace_DataHandle.hpp>
 #include <Kokkos_NVSHMEMSpace_ViewTraits.hpp>
+#include <Kokkos_RemoteSpaces_Signal.hpp>
+#include <Kokkos_RemoteSpaces_LocalView.hpp>
+#include <Kokkos_RemoteSpaces_Halo.hpp>
+#include <Kokkos_RemoteSpaces_Gather.hpp>
+#include <Kokkos_RemoteSpaces_Scatter.hpp>
 
 #endif  // #define KOKKOS_NVSHMEMSPACE_HPP
@@ -65,6 +65,14 @@ struct NVSHMEMDataHandle {
     return element;
   }
 
+  // Element of the calling PE's own allocation
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION NVSHMEMDataElement<T, Traits> local(
+      const int &pe, const iType &i) const {
+    NVSHMEMDataElement<T, Traits> element(ptr, pe, i, ptr + i);
+    return element;
+  }
+
   KOKKOS_INLINE_FUNCTION
   T *operator+(size_t &offset) const { return ptr + offset; }
 };
@@ -103,6 +111,105 @@ struct ViewDataHandle<
   }
 };
 
+// Puts n elements from src to dst on pe and then sets the signal sig on pe
+template <class T, class Traits, class SigTraits>
+inline void put_signal(const NVSHMEMDataHandle<T, Traits> &dst, const T *src,
+                       size_t n,
+                       const NVSHMEMDataHandle<uint64_t, SigTraits> &sig,
+                       uint64_t value, int pe) {
+  nvshmem_putmem_signal(dst.ptr, src, n * sizeof(T), sig.ptr, value,
+                        NVSHMEM_SIGNAL_SET, pe);
+}
+
+// Waits until the local signal sig is at least value
+template <class Traits>
+inline void signal_wait_until(const NVSHMEMDataHandle<uint64_t, Traits> &sig,
+                              uint64_t value) {
+  nvshmem_signal_wait_until(sig.ptr, NVSHMEM_CMP_GE, value);
+}
+
+// Starts a get of n elements at offset in src on pe into dst. The get is
+// completed by the next fence of the memory space
+template <class T, class Traits>
+KOKKOS_INLINE_FUNCTION void get_nbi(T *dst,
+                                    const NVSHMEMDataHandle<T, Traits> &src,
+                                    size_t offset, size_t n, int pe) {
+  nvshmem_getmem_nbi(dst, src.ptr + offset, n * sizeof(T), pe);
+}
+
+// Starts a put of n elements from src to offset in dst on pe. The put is
+// completed by the next fence of the memory space
+template <class T, class Traits>
+KOKKOS_INLINE_FUNCTION void put_nbi(const NVSHMEMDataHandle<T, Traits> &dst,
+                                    size_t offset, const T *src, size_t n,
+                                    int pe) {
+  nvshmem_putmem_nbi(dst.ptr + offset, src, n * sizeof(T), pe);
+}
+
+// Gets n elements at offset in src on pe into dst
+template <class T, class Traits>
+KOKKOS_INLINE_FUNCTION void get_bulk(T *dst,
+                                     const NVSHMEMDataHandle<T, Traits> &src,
+                                     size_t offset, size_t n, int pe) {
+  nvshmem_getmem(dst, src.ptr + offset, n * sizeof(T), pe);
+}
+
+// Puts n elements from src to offset in dst on pe. Remote completion
+// requires a fence of the memory space
+template <class T, class Traits>
+KOKKOS_INLINE_FUNCTION void put_bulk(const NVSHMEMDataHandle<T, Traits> &dst,
+                                     size_t offset, const T *src, size_t n,
+                                     int pe) {
+  nvshmem_putmem(dst.ptr + offset, src, n * sizeof(T), pe);
+}
+
+// Gets n elements spaced src_stride apart at offset in src on pe into dst,
+// spaced dst_stride apart. Strides count elements
+template <class T, class Traits>
+KOKKOS_INLINE_FUNCTION void get_strided(T *dst, ptrdiff_t dst_stride,
+                                        const NVSHMEMDataHandle<T, Traits> &src,
+                                        size_t offset, ptrdiff_t src_stride,
+                                        size_t n, int pe) {
+  const T *source = src.ptr + offset;
+  switch (sizeof(T)) {
+    case 1: nvshmem_iget8(dst, source, dst_stride, src_stride, n, pe); break;
+    case 2: nvshmem_iget16(dst, source, dst_stride, src_stride, n, pe); break;
+    case 4: nvshmem_iget32(dst, source, dst_stride, src_stride, n, pe); break;
+    case 8: nvshmem_iget64(dst, source, dst_stride, src_stride, n, pe); break;
+    case 16:
+      nvshmem_iget128(dst, source, dst_stride, src_stride, n, pe);
+      break;
+    default:
+      for (size_t i = 0; i < n; ++i)
+        nvshmem_getmem(dst + i * dst_stride, source + i * src_stride,
+                       sizeof(T), pe);
+  }
+}
+
+// Puts n elements spaced src_stride apart from src to offset in dst on pe,
+// spaced dst_stride apart. Remote completion requires a fence of the memory
+// space
+template <class T, class Traits>
+KOKKOS_INLINE_FUNCTION void put_strided(const NVSHMEMDataHandle<T, Traits> &dst,
+                                        size_t offset, ptrdiff_t dst_stride,
+                                        const T *src, ptrdiff_t src_stride,
+                                        size_t n, int pe) {
+  T *dest = dst.ptr + offset;
+  switch (sizeof(T)) {
+    case 1: nvshmem_iput8(dest, src, dst_stride, src_stride, n, pe); break;
+    case 2: nvshmem_iput16(dest, src, dst_stride, src_stride, n, pe); break;
+    case 4: nvshmem_iput32(dest, src, dst_stride, src_stride, n, pe); break;
+    case 8: nvshmem_iput64(dest, src, dst_stride, src_stride, n, pe); break;
+    case 16:
+      nvshmem_iput128(dest, src, dst_stride, src_stride, n, pe);
+      break;
+    default:
+      for (size_t i = 0; i < n; ++i)
+        nvshmem_putmem(dest + i * dst_stride, src + i * src_stride, sizeof(T),
+                       pe);
+  }
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
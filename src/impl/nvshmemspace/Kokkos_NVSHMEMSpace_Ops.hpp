@@ -208,7 +208,8 @@ struct NVSHMEMDataElement<
   int pe;
 
   KOKKOS_INLINE_FUNCTION
-  NVSHMEMDataElement(T *ptr_, int pe_, int i_) : ptr(ptr_ + i_), pe(pe_) {}
+  NVSHMEMDataElement(T *ptr_, int pe_, size_t i_, T * = nullptr)
+      : ptr(ptr_ + i_), pe(pe_) {}
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
@@ -523,302 +524,283 @@ struct NVSHMEMDataElement<
   typedef T non_const_value_type;
   T *ptr;
   int pe;
+  // Element address if directly accessible through load/store, else nullptr
+  T *direct_ptr;
 
   KOKKOS_INLINE_FUNCTION
-  NVSHMEMDataElement(T *ptr_, int pe_, int i_) : ptr(ptr_ + i_), pe(pe_) {}
+  NVSHMEMDataElement(T *ptr_, int pe_, size_t i_,
+                     T *direct_ptr_ = nullptr)
+      : ptr(ptr_ + i_), pe(pe_), direct_ptr(direct_ptr_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  T get() const {
+    if (direct_ptr) return *direct_ptr;
+    return shmem_type_g(ptr, pe);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void put(const T &val) const {
+    if (direct_ptr)
+      *direct_ptr = val;
+    else
+      shmem_type_p(ptr, val, pe);
+  }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
-    shmem_type_p(ptr, val, pe);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   void inc() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp++;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
-    T tmp;
-    shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp--;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
-    T tmp;
-    shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp++;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp--;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp++;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp--;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp += val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp -= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp *= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp /= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp %= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp &= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp ^= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp |= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp <<= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp >>= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp - val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp * val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp / val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp % val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator!() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return !tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&&(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp && val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator||(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp || val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp & val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp | val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp ^ val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator~() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return ~tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<(const unsigned int &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp << val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>(const unsigned int &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp >> val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator==(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp == val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator!=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp != val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp >= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp <= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp < val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp > val;
   }
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp;
   }
 };
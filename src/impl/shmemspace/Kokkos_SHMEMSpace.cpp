@@ -43,14 +43,56 @@
 */
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces_SymmetricArena.hpp>
 #include <Kokkos_SHMEMSpace.hpp>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
 #include <shmem.h>
+#include <unordered_set>
+#include <vector>
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
 namespace Kokkos {
 namespace Experimental {
 
+namespace {
+
+// Symmetric arena serving all allocations, reserved by the first allocation
+// if KOKKOS_REMOTE_SPACES_ARENA_SIZE is set
+Kokkos::Impl::SymmetricArena *get_arena() {
+  static Kokkos::Impl::SymmetricArena *arena =
+      []() -> Kokkos::Impl::SymmetricArena * {
+    const size_t size = Kokkos::Impl::get_symmetric_arena_size();
+    if (!size) return nullptr;
+    void *base = shmem_malloc(size);
+    if (!base) Kokkos::abort("SHMEMSpace arena allocation failed.");
+    Kokkos::Impl::SymmetricArena *a = new Kokkos::Impl::SymmetricArena(
+        base, size, Kokkos::Impl::MEMORY_ALIGNMENT);
+    Kokkos::push_finalize_hook([a]() {
+      shmem_free(a->get_base());
+      delete a;
+    });
+    return a;
+  }();
+  return arena;
+}
+
+// Allocations made in Cached mode. Only their lines are dropped from the
+// read cache when they are released
+struct CachedAllocations {
+  std::mutex mutex;
+  std::unordered_set<const void *> ptrs;
+};
+
+CachedAllocations &get_cached_allocations() {
+  static CachedAllocations cached;
+  return cached;
+}
+
+}  // namespace
+
 /* Default allocation mechanism */
 SHMEMSpace::SHMEMSpace() : allocation_mode(Kokkos::Experimental::Symmetric) {}
 
@@ -60,6 +102,10 @@ void SHMEMSpace::impl_set_allocation_mode(const int allocation_mode_) {
 
 void SHMEMSpace::impl_set_extent(const int64_t extent_) { extent = extent_; }
 
+size_t SHMEMSpace::impl_get_num_pes() const { return get_num_pes(); }
+
+size_t SHMEMSpace::impl_get_my_pe() const { return get_my_pe(); }
+
 void *SHMEMSpace::allocate(const size_t arg_alloc_size) const {
   static_assert(sizeof(void *) == sizeof(uintptr_t),
                 "Error sizeof(void*) != sizeof(uintptr_t)");
@@ -68,26 +114,62 @@ void *SHMEMSpace::allocate(const size_t arg_alloc_size) const {
       Kokkos::Impl::is_integral_power_of_two(Kokkos::Impl::MEMORY_ALIGNMENT),
       "Memory alignment must be power of two");
 
+  Kokkos::Impl::SHMEMContexts::initialize();
+
   void *ptr = 0;
   if (arg_alloc_size) {
-    if (allocation_mode == Kokkos::Experimental::Symmetric) {
+    // Cached allocations are symmetric allocations whose element reads go
+    // through the read cache
+    if (allocation_mode == Kokkos::Experimental::Symmetric ||
+        allocation_mode == Kokkos::Experimental::Cached) {
       int num_pes = shmem_n_pes();
       int my_id   = shmem_my_pe();
-      ptr         = shmem_malloc(arg_alloc_size);
+      if (Kokkos::Impl::SymmetricArena *arena = get_arena())
+        ptr = arena->allocate(arg_alloc_size);
+      // Arena blocks skip the barrier of the symmetric allocation, which
+      // keeps PEs from reusing memory that others still access
+      if (ptr) shmem_barrier_all();
+      // Fall back to a dedicated allocation once the arena is exhausted
+      if (!ptr) ptr = shmem_malloc(arg_alloc_size);
+      if (ptr && allocation_mode == Kokkos::Experimental::Cached) {
+        CachedAllocations &cached = get_cached_allocations();
+        std::lock_guard<std::mutex> lock(cached.mutex);
+        cached.ptrs.insert(ptr);
+      }
     } else {
-      Kokkos::abort("SHMEMSpace only supports symmetric allocation policy.");
+      Kokkos::abort(
+          "SHMEMSpace only supports symmetric and cached allocation policies.");
     }
   }
   return ptr;
 }
 
 void SHMEMSpace::deallocate(void *const arg_alloc_ptr, const size_t) const {
+  bool cached_allocation;
+  {
+    CachedAllocations &cached = get_cached_allocations();
+    std::lock_guard<std::mutex> lock(cached.mutex);
+    cached_allocation = cached.ptrs.erase(arg_alloc_ptr) != 0;
+  }
+  // Lines of the allocation must not be served to a later one at the same
+  // address. The cache identifies them by the data following the header
+  if (cached_allocation)
+    Kokkos::Impl::get_read_cache().forget(
+        static_cast<char *>(arg_alloc_ptr) +
+        sizeof(Kokkos::Impl::SharedAllocationHeader));
+  Kokkos::Impl::SymmetricArena *arena = get_arena();
+  if (arena && arena->deallocate(arg_alloc_ptr)) return;
   shmem_free(arg_alloc_ptr);
 }
 
 void SHMEMSpace::fence() {
   Kokkos::fence();
+  // Complete outstanding non-blocking transfers before synchronizing
+  Kokkos::Impl::SHMEMContexts::quiet();
+  shmem_quiet();
   shmem_barrier_all();
+  // Remote data may have changed since the cached lines were read
+  Kokkos::Impl::get_read_cache().invalidate();
 }
 
 size_t get_num_pes() { return shmem_n_pes(); }
@@ -121,6 +203,18 @@ std::pair<size_t, size_t> getRange(size_t size, size_t pe) {
   return std::make_pair(start, end);
 }
 
+size_t get_num_pes(const SHMEMSpace &) { return get_num_pes(); }
+
+size_t get_my_pe(const SHMEMSpace &) { return get_my_pe(); }
+
+size_t get_indexing_block_size(size_t size, const SHMEMSpace &) {
+  return get_indexing_block_size(size);
+}
+
+std::pair<size_t, size_t> getRange(size_t size, size_t pe, const SHMEMSpace &) {
+  return getRange(size, pe);
+}
+
 }  // namespace Experimental
 
 namespace Impl {
@@ -165,16 +259,87 @@ Kokkos::Impl::DeepCopy<Kokkos::Experimental::SHMEMSpace,
   memcpy(dst, src, n);
 }
 
-// Currently not invoked. We need a better local_deep_copy overload that
-// recognizes consecutive memory regions
+shmem_ctx_t *SHMEMContexts::contexts = nullptr;
+int SHMEMContexts::num_contexts       = 0;
+
+namespace {
+// Sources of non-blocking element puts of one context. Emptied by quiet
+struct SHMEMStage {
+  static constexpr size_t capacity = 64 * 1024;
+  std::vector<char> buffer;
+  size_t used = 0;
+};
+
+std::vector<SHMEMStage> stages;
+
+void initialize_stages() {
+  if (!stages.empty()) return;
+  stages = std::vector<SHMEMStage>(SHMEMContexts::num_contexts + 1);
+  for (auto &stage : stages) stage.buffer.resize(SHMEMStage::capacity);
+  Kokkos::push_finalize_hook([]() { stages.clear(); });
+}
+}  // namespace
+
+const void *SHMEMContexts::stage(int id, const void *src, size_t n) {
+  if (size_t(id) >= stages.size() || n > SHMEMStage::capacity) return nullptr;
+  SHMEMStage &stage = stages[id];
+  if (stage.used + n > SHMEMStage::capacity) {
+    // Complete the puts of this context before reusing their sources
+    shmem_ctx_quiet(id < num_contexts ? contexts[id] : SHMEM_CTX_DEFAULT);
+    stage.used = 0;
+  }
+  char *dst = stage.buffer.data() + stage.used;
+  std::memcpy(dst, src, n);
+  // Keep the next source aligned for any element type
+  stage.used += (n + alignof(std::max_align_t) - 1) /
+                alignof(std::max_align_t) * alignof(std::max_align_t);
+  return dst;
+}
+
+void SHMEMContexts::initialize() {
+#if defined(KOKKOS_ENABLE_OPENMP)
+  using execution_space = Kokkos::Experimental::SHMEMSpace::execution_space;
+  if (!std::is_same<execution_space, Kokkos::OpenMP>::value) {
+    initialize_stages();
+    return;
+  }
+  static bool initialized = []() {
+    const int num = execution_space::concurrency();
+    contexts      = new shmem_ctx_t[num];
+    for (int i = 0; i < num; ++i) {
+      // Fall back to the default context if the library runs out of contexts
+      if (shmem_ctx_create(SHMEM_CTX_SERIALIZED, &contexts[i]))
+        contexts[i] = SHMEM_CTX_DEFAULT;
+    }
+    num_contexts = num;
+    Kokkos::push_finalize_hook([]() {
+      for (int i = 0; i < num_contexts; ++i)
+        if (contexts[i] != SHMEM_CTX_DEFAULT) shmem_ctx_destroy(contexts[i]);
+      delete[] contexts;
+      contexts     = nullptr;
+      num_contexts = 0;
+    });
+    return true;
+  }();
+  (void)initialized;
+#endif
+  initialize_stages();
+}
+
+void SHMEMContexts::quiet() {
+  for (int i = 0; i < num_contexts; ++i) shmem_ctx_quiet(contexts[i]);
+  shmem_ctx_quiet(SHMEM_CTX_DEFAULT);
+  for (auto &stage : stages) stage.used = 0;
+}
+
+// Bulk transfers of n bytes between local memory and the address of a
+// symmetric allocation on pe
 void local_deep_copy_get(void *dst, const void *src, size_t pe, size_t n) {
-  shmem_getmem(dst, src, pe, n);
+  shmem_ctx_getmem(get_shmem_ctx(), dst, src, n, pe);
 }
 
-// Currently not invoked. We need a better local_deep_copy overload that
-// recognizes consecutive memory regions
 void local_deep_copy_put(void *dst, const void *src, size_t pe, size_t n) {
-  shmem_putmem(dst, src, pe, n);
+  shmem_ctx_putmem(get_shmem_ctx(), dst, src, n, pe);
 }
 
 }  // namespace Impl
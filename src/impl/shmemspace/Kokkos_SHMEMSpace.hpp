@@ -109,6 +109,9 @@ class SHMEMSpace {
   int allocation_mode;
   int64_t extent;
 
+  size_t impl_get_num_pes() const;
+  size_t impl_get_my_pe() const;
+
   void impl_set_allocation_mode(const int);
   void impl_set_extent(int64_t N);
 
@@ -123,6 +126,13 @@ size_t get_my_pe();
 size_t get_indexing_block_size(size_t size);
 std::pair<size_t, size_t> getRange(size_t size, size_t pe);
 
+// All PEs take part in every SHMEMSpace instance
+size_t get_num_pes(const SHMEMSpace &space);
+size_t get_my_pe(const SHMEMSpace &space);
+size_t get_indexing_block_size(size_t size, const SHMEMSpace &space);
+std::pair<size_t, size_t> getRange(size_t size, size_t pe,
+                                   const SHMEMSpace &space);
+
 }  // namespace Experimental
 }  // namespace Kokkos
 
@@ -152,6 +162,9 @@ struct DeepCopy<Kokkos::Experimental::SHMEMSpace,
   DeepCopy(const ExecutionSpace &exec, void *dst, const void *src, size_t n);
 };
 
+void local_deep_copy_get(void *dst, const void *src, size_t pe, size_t n);
+void local_deep_copy_put(void *dst, const void *src, size_t pe, size_t n);
+
 template <>
 struct MemorySpaceAccess<Kokkos::Experimental::SHMEMSpace,
                          Kokkos::Experimental::SHMEMSpace> {
@@ -176,9 +189,15 @@ struct MemorySpaceAccess<Kokkos::HostSpace, Kokkos::Experimental::SHMEMSpace> {
 #include <Kokkos_RemoteSpaces_Options.hpp>
 #include <Kokkos_RemoteSpaces_ViewOffset.hpp>
 #include <Kokkos_RemoteSpaces_ViewMapping.hpp>
+#include <Kokkos_RemoteSpaces_ReadCache.hpp>
 #include <Kokkos_SHMEMSpace_Ops.hpp>
 #include <Kokkos_SHMEMSpace_AllocationRecord.hpp>
 #include <Kokkos_SHMEMSpace_DataHandle.hpp>
 #include <Kokkos_SHMEMSpace_ViewTraits.hpp>
+#include <Kokkos_RemoteSpaces_Signal.hpp>
+#include <Kokkos_RemoteSpaces_LocalView.hpp>
+#include <Kokkos_RemoteSpaces_Halo.hpp>
+#include <Kokkos_RemoteSpaces_Gather.hpp>
+#include <Kokkos_RemoteSpaces_Scatter.hpp>
 
 #endif  // #define KOKKOS_SHMEMSPACE_HPP
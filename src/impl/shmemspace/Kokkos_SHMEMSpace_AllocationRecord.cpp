@@ -81,6 +81,14 @@ SharedAllocationRecord<Kokkos::Experimental::SHMEMSpace, void>::
       static_cast<SharedAllocationRecord<void, void> *>(this);
   strncpy(RecordBase::m_alloc_ptr->m_label, arg_label.c_str(),
           SharedAllocationHeader::maximum_label_length);
+
+  // Resolve direct mappings of this allocation on peer PEs once such that
+  // accesses to PEs sharing the symmetric heap become loads and stores
+  const int num_pes = shmem_n_pes();
+  peer_ptrs.resize(num_pes);
+  for (int pe = 0; pe < num_pes; ++pe) {
+    peer_ptrs[pe] = static_cast<char *>(shmem_ptr(data(), pe));
+  }
 }
 
 SharedAllocationRecord<Kokkos::Experimental::SHMEMSpace,
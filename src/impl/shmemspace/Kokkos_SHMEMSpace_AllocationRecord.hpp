@@ -46,6 +46,7 @@
 #define KOKKOS_SHMEM_ALLOCREC_HPP
 
 #include <Kokkos_Core.hpp>
+#include <vector>
 
 /*--------------------------------------------------------------------------*/
 
@@ -81,6 +82,10 @@ class SharedAllocationRecord<Kokkos::Experimental::SHMEMSpace, void>
       const RecordBase::function_type arg_dealloc = &deallocate);
 
  public:
+  // Local addresses of the allocation on each PE if directly addressable
+  // (see shmem_ptr), nullptr otherwise
+  std::vector<char *> peer_ptrs;
+
   inline std::string get_label() const {
     return std::string(RecordBase::head()->m_label);
   }
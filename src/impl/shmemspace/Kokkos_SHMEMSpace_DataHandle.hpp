@@ -51,17 +51,50 @@ namespace Impl {
 template <class T, class Traits>
 struct SHMEMDataHandle {
   T *ptr;
+  // Per-PE direct mappings of the allocation starting at base
+  char *const *peer_ptrs;
+  char *base;
+  // Size in bytes of the allocation if element reads go through the read
+  // cache (Cached allocation mode), else 0
+  size_t cached_size;
   KOKKOS_INLINE_FUNCTION
-  SHMEMDataHandle() : ptr(NULL) {}
+  SHMEMDataHandle()
+      : ptr(NULL), peer_ptrs(NULL), base(NULL), cached_size(0) {}
   KOKKOS_INLINE_FUNCTION
-  SHMEMDataHandle(T *ptr_) : ptr(ptr_) {}
+  SHMEMDataHandle(T *ptr_)
+      : ptr(ptr_), peer_ptrs(NULL), base(NULL), cached_size(0) {}
   KOKKOS_INLINE_FUNCTION
-  SHMEMDataHandle(SHMEMDataHandle<T, Traits> const &arg) : ptr(arg.ptr) {}
+  SHMEMDataHandle(T *ptr_, char *const *peer_ptrs_, char *base_,
+                  size_t cached_size_ = 0)
+      : ptr(ptr_),
+        peer_ptrs(peer_ptrs_),
+        base(base_),
+        cached_size(cached_size_) {}
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataHandle(SHMEMDataHandle<T, Traits> const &arg)
+      : ptr(arg.ptr),
+        peer_ptrs(arg.peer_ptrs),
+        base(arg.base),
+        cached_size(arg.cached_size) {}
 
   template <typename iType>
   KOKKOS_INLINE_FUNCTION SHMEMDataElement<T, Traits> operator()(
       const int &pe, const iType &i) const {
-    SHMEMDataElement<T, Traits> element(ptr, pe, i);
+    T *direct_ptr = NULL;
+    if (peer_ptrs && peer_ptrs[pe]) {
+      direct_ptr = reinterpret_cast<T *>(
+          peer_ptrs[pe] + (reinterpret_cast<char *>(ptr + i) - base));
+    }
+    SHMEMDataElement<T, Traits> element(ptr, pe, i, direct_ptr, base,
+                                        cached_size);
+    return element;
+  }
+
+  // Element of the calling PE's own allocation
+  template <typename iType>
+  KOKKOS_INLINE_FUNCTION SHMEMDataElement<T, Traits> local(
+      const int &pe, const iType &i) const {
+    SHMEMDataElement<T, Traits> element(ptr, pe, i, ptr + i);
     return element;
   }
 
@@ -88,7 +121,8 @@ struct ViewDataHandle<
   template <class SrcHandleType>
   KOKKOS_INLINE_FUNCTION static handle_type assign(
       SrcHandleType const arg_data_ptr, size_t offset) {
-    return handle_type(arg_data_ptr + offset);
+    return handle_type(arg_data_ptr + offset, arg_data_ptr.peer_ptrs,
+                       arg_data_ptr.base, arg_data_ptr.cached_size);
   }
 
   template <class SrcHandleType>
@@ -103,6 +137,138 @@ struct ViewDataHandle<
   }
 };
 
+// Puts n elements from src to dst on pe and then sets the signal sig on pe
+template <class T, class Traits, class SigTraits>
+inline void put_signal(const SHMEMDataHandle<T, Traits> &dst, const T *src,
+                       size_t n,
+                       const SHMEMDataHandle<uint64_t, SigTraits> &sig,
+                       uint64_t value, int pe) {
+#if SHMEM_MAJOR_VERSION > 1 || SHMEM_MINOR_VERSION >= 5
+  shmem_ctx_putmem_signal(get_shmem_ctx(), dst.ptr, src, n * sizeof(T),
+                          sig.ptr, value, SHMEM_SIGNAL_SET, pe);
+#else
+  // Order the signal after the data with a fence before OpenSHMEM 1.5
+  shmem_ctx_putmem(get_shmem_ctx(), dst.ptr, src, n * sizeof(T), pe);
+  shmem_ctx_fence(get_shmem_ctx());
+  shmem_type_atomic_set(sig.ptr, value, pe);
+#endif
+}
+
+// Waits until the local signal sig is at least value
+template <class Traits>
+inline void signal_wait_until(const SHMEMDataHandle<uint64_t, Traits> &sig,
+                              uint64_t value) {
+#if SHMEM_MAJOR_VERSION > 1 || SHMEM_MINOR_VERSION >= 5
+  shmem_signal_wait_until(sig.ptr, SHMEM_CMP_GE, value);
+#else
+  shmem_uint64_wait_until(sig.ptr, SHMEM_CMP_GE, value);
+#endif
+}
+
+// Starts a get of n elements at offset in src on pe into dst. The get is
+// completed by the next fence of the memory space
+template <class T, class Traits>
+inline void get_nbi(T *dst, const SHMEMDataHandle<T, Traits> &src,
+                    size_t offset, size_t n, int pe) {
+  shmem_ctx_getmem_nbi(get_shmem_ctx(), dst, src.ptr + offset, n * sizeof(T),
+                       pe);
+}
+
+// Starts a put of n elements from src to offset in dst on pe. The put is
+// completed by the next fence of the memory space
+template <class T, class Traits>
+inline void put_nbi(const SHMEMDataHandle<T, Traits> &dst, size_t offset,
+                    const T *src, size_t n, int pe) {
+  shmem_ctx_putmem_nbi(get_shmem_ctx(), dst.ptr + offset, src, n * sizeof(T),
+                       pe);
+}
+
+// Gets n elements at offset in src on pe into dst
+template <class T, class Traits>
+inline void get_bulk(T *dst, const SHMEMDataHandle<T, Traits> &src,
+                     size_t offset, size_t n, int pe) {
+  shmem_ctx_getmem(get_shmem_ctx(), dst, src.ptr + offset, n * sizeof(T), pe);
+}
+
+// Puts n elements from src to offset in dst on pe. Remote completion
+// requires a fence of the memory space
+template <class T, class Traits>
+inline void put_bulk(const SHMEMDataHandle<T, Traits> &dst, size_t offset,
+                     const T *src, size_t n, int pe) {
+  shmem_ctx_putmem(get_shmem_ctx(), dst.ptr + offset, src, n * sizeof(T), pe);
+}
+
+// Gets n elements spaced src_stride apart at offset in src on pe into dst,
+// spaced dst_stride apart. Strides count elements
+template <class T, class Traits>
+inline void get_strided(T *dst, ptrdiff_t dst_stride,
+                        const SHMEMDataHandle<T, Traits> &src, size_t offset,
+                        ptrdiff_t src_stride, size_t n, int pe) {
+  const T *source = src.ptr + offset;
+  switch (sizeof(T)) {
+    case 1:
+      shmem_ctx_iget8(get_shmem_ctx(), dst, source, dst_stride, src_stride, n,
+                      pe);
+      break;
+    case 2:
+      shmem_ctx_iget16(get_shmem_ctx(), dst, source, dst_stride, src_stride,
+                       n, pe);
+      break;
+    case 4:
+      shmem_ctx_iget32(get_shmem_ctx(), dst, source, dst_stride, src_stride,
+                       n, pe);
+      break;
+    case 8:
+      shmem_ctx_iget64(get_shmem_ctx(), dst, source, dst_stride, src_stride,
+                       n, pe);
+      break;
+    case 16:
+      shmem_ctx_iget128(get_shmem_ctx(), dst, source, dst_stride, src_stride,
+                        n, pe);
+      break;
+    default:
+      for (size_t i = 0; i < n; ++i)
+        shmem_ctx_getmem(get_shmem_ctx(), dst + i * dst_stride,
+                         source + i * src_stride, sizeof(T), pe);
+  }
+}
+
+// Puts n elements spaced src_stride apart from src to offset in dst on pe,
+// spaced dst_stride apart. Remote completion requires a fence of the memory
+// space
+template <class T, class Traits>
+inline void put_strided(const SHMEMDataHandle<T, Traits> &dst, size_t offset,
+                        ptrdiff_t dst_stride, const T *src,
+                        ptrdiff_t src_stride, size_t n, int pe) {
+  T *dest = dst.ptr + offset;
+  switch (sizeof(T)) {
+    case 1:
+      shmem_ctx_iput8(get_shmem_ctx(), dest, src, dst_stride, src_stride, n,
+                      pe);
+      break;
+    case 2:
+      shmem_ctx_iput16(get_shmem_ctx(), dest, src, dst_stride, src_stride, n,
+                       pe);
+      break;
+    case 4:
+      shmem_ctx_iput32(get_shmem_ctx(), dest, src, dst_stride, src_stride, n,
+                       pe);
+      break;
+    case 8:
+      shmem_ctx_iput64(get_shmem_ctx(), dest, src, dst_stride, src_stride, n,
+                       pe);
+      break;
+    case 16:
+      shmem_ctx_iput128(get_shmem_ctx(), dest, src, dst_stride, src_stride,
+                        n, pe);
+      break;
+    default:
+      for (size_t i = 0; i < n; ++i)
+        shmem_ctx_putmem(get_shmem_ctx(), dest + i * dst_stride,
+                         src + i * src_stride, sizeof(T), pe);
+  }
+}
+
 }  // namespace Impl
 }  // namespace Kokkos
 
@@ -47,147 +47,242 @@
 
 #include <shmem.h>
 #include <type_traits>
+#if defined(KOKKOS_ENABLE_OPENMP)
+#include <omp.h>
+#endif
 
 namespace Kokkos {
 namespace Impl {
 
+// Communication contexts, one per OpenMP thread, so that concurrent threads
+// do not contend on the default context. Created by the first allocation
+struct SHMEMContexts {
+  static shmem_ctx_t *contexts;
+  static int num_contexts;
+
+  static void initialize();
+  static void quiet();
+
+  // Copies n bytes from src to the staging buffer of context id, where they
+  // stay valid until the next quiet. Returns nullptr before initialize()
+  static const void *stage(int id, const void *src, size_t n);
+};
+
+// Index of the context of the calling thread, num_contexts for the default
+// context
+static KOKKOS_INLINE_FUNCTION int get_shmem_ctx_id() {
+#if defined(KOKKOS_ENABLE_OPENMP)
+  if (std::is_same<Kokkos::Experimental::SHMEMSpace::execution_space,
+                   Kokkos::OpenMP>::value) {
+    const int id = omp_get_thread_num();
+    if (id < SHMEMContexts::num_contexts) return id;
+  }
+#endif
+  return SHMEMContexts::num_contexts;
+}
+
+// Context of the calling thread, the default context outside of OpenMP
+static KOKKOS_INLINE_FUNCTION shmem_ctx_t get_shmem_ctx() {
+#if defined(KOKKOS_ENABLE_OPENMP)
+  const int id = get_shmem_ctx_id();
+  if (id < SHMEMContexts::num_contexts) return SHMEMContexts::contexts[id];
+#endif
+  return SHMEM_CTX_DEFAULT;
+}
+
 #define KOKKOS_REMOTESPACES_P(type, op)                                       \
   static KOKKOS_INLINE_FUNCTION void shmem_type_p(type *ptr, const type &val, \
                                                   int pe) {                   \
-    op(ptr, val, pe);                                                         \
-  }
-
-KOKKOS_REMOTESPACES_P(char, shmem_char_p)
-KOKKOS_REMOTESPACES_P(unsigned char, shmem_uchar_p)
-KOKKOS_REMOTESPACES_P(short, shmem_short_p)
-KOKKOS_REMOTESPACES_P(unsigned short, shmem_ushort_p)
-KOKKOS_REMOTESPACES_P(int, shmem_int_p)
-KOKKOS_REMOTESPACES_P(unsigned int, shmem_uint_p)
-KOKKOS_REMOTESPACES_P(long, shmem_long_p)
-KOKKOS_REMOTESPACES_P(unsigned long, shmem_ulong_p)
-KOKKOS_REMOTESPACES_P(long long, shmem_longlong_p)
-KOKKOS_REMOTESPACES_P(unsigned long long, shmem_ulonglong_p)
-KOKKOS_REMOTESPACES_P(float, shmem_float_p)
-KOKKOS_REMOTESPACES_P(double, shmem_double_p)
+    op(get_shmem_ctx(), ptr, val, pe);                                        \
+  }
+
+KOKKOS_REMOTESPACES_P(char, shmem_ctx_char_p)
+KOKKOS_REMOTESPACES_P(unsigned char, shmem_ctx_uchar_p)
+KOKKOS_REMOTESPACES_P(short, shmem_ctx_short_p)
+KOKKOS_REMOTESPACES_P(unsigned short, shmem_ctx_ushort_p)
+KOKKOS_REMOTESPACES_P(int, shmem_ctx_int_p)
+KOKKOS_REMOTESPACES_P(unsigned int, shmem_ctx_uint_p)
+KOKKOS_REMOTESPACES_P(long, shmem_ctx_long_p)
+KOKKOS_REMOTESPACES_P(unsigned long, shmem_ctx_ulong_p)
+KOKKOS_REMOTESPACES_P(long long, shmem_ctx_longlong_p)
+KOKKOS_REMOTESPACES_P(unsigned long long, shmem_ctx_ulonglong_p)
+KOKKOS_REMOTESPACES_P(float, shmem_ctx_float_p)
+KOKKOS_REMOTESPACES_P(double, shmem_ctx_double_p)
 
 #undef KOKKOS_REMOTESPACES_P
 
+// Non-blocking put: val is staged in a buffer of the calling thread's context
+// that stays valid until the put completes at the next fence
+#define KOKKOS_REMOTESPACES_P_NBI(type, op)                            \
+  static KOKKOS_INLINE_FUNCTION void shmem_type_p_nbi(type *ptr,       \
+                                                      const type &val, \
+                                                      int pe) {        \
+    const int id    = get_shmem_ctx_id();                              \
+    const void *src = SHMEMContexts::stage(id, &val, sizeof(type));    \
+    if (src)                                                           \
+      op(get_shmem_ctx(), ptr, static_cast<const type *>(src), 1, pe); \
+    else                                                               \
+      shmem_type_p(ptr, val, pe);                                      \
+  }
+
+KOKKOS_REMOTESPACES_P_NBI(char, shmem_ctx_char_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(unsigned char, shmem_ctx_uchar_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(short, shmem_ctx_short_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(unsigned short, shmem_ctx_ushort_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(int, shmem_ctx_int_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(unsigned int, shmem_ctx_uint_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(long, shmem_ctx_long_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(unsigned long, shmem_ctx_ulong_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(long long, shmem_ctx_longlong_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(unsigned long long, shmem_ctx_ulonglong_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(float, shmem_ctx_float_put_nbi)
+KOKKOS_REMOTESPACES_P_NBI(double, shmem_ctx_double_put_nbi)
+
+#undef KOKKOS_REMOTESPACES_P_NBI
+
 #define KOKKOS_REMOTESPACES_G(type, op)                                \
   static KOKKOS_INLINE_FUNCTION type shmem_type_g(type *ptr, int pe) { \
-    return op(ptr, pe);                                                \
-  }
-
-KOKKOS_REMOTESPACES_G(char, shmem_char_g)
-KOKKOS_REMOTESPACES_G(unsigned char, shmem_uchar_g)
-KOKKOS_REMOTESPACES_G(short, shmem_short_g)
-KOKKOS_REMOTESPACES_G(unsigned short, shmem_ushort_g)
-KOKKOS_REMOTESPACES_G(int, shmem_int_g)
-KOKKOS_REMOTESPACES_G(unsigned int, shmem_uint_g)
-KOKKOS_REMOTESPACES_G(long, shmem_long_g)
-KOKKOS_REMOTESPACES_G(unsigned long, shmem_ulong_g)
-KOKKOS_REMOTESPACES_G(long long, shmem_longlong_g)
-KOKKOS_REMOTESPACES_G(unsigned long long, shmem_ulonglong_g)
-KOKKOS_REMOTESPACES_G(float, shmem_float_g)
-KOKKOS_REMOTESPACES_G(double, shmem_double_g)
+    return op(get_shmem_ctx(), ptr, pe);                               \
+  }
+
+KOKKOS_REMOTESPACES_G(char, shmem_ctx_char_g)
+KOKKOS_REMOTESPACES_G(unsigned char, shmem_ctx_uchar_g)
+KOKKOS_REMOTESPACES_G(short, shmem_ctx_short_g)
+KOKKOS_REMOTESPACES_G(unsigned short, shmem_ctx_ushort_g)
+KOKKOS_REMOTESPACES_G(int, shmem_ctx_int_g)
+KOKKOS_REMOTESPACES_G(unsigned int, shmem_ctx_uint_g)
+KOKKOS_REMOTESPACES_G(long, shmem_ctx_long_g)
+KOKKOS_REMOTESPACES_G(unsigned long, shmem_ctx_ulong_g)
+KOKKOS_REMOTESPACES_G(long long, shmem_ctx_longlong_g)
+KOKKOS_REMOTESPACES_G(unsigned long long, shmem_ctx_ulonglong_g)
+KOKKOS_REMOTESPACES_G(float, shmem_ctx_float_g)
+KOKKOS_REMOTESPACES_G(double, shmem_ctx_double_g)
 
 #undef KOKKOS_REMOTESPACES_G
 
+#define KOKKOS_REMOTESPACES_G_NBI(type, op)                                 \
+  static KOKKOS_INLINE_FUNCTION void shmem_type_g_nbi(type *dst, type *ptr, \
+                                                      int pe) {             \
+    op(get_shmem_ctx(), dst, ptr, 1, pe);                                   \
+  }
+
+KOKKOS_REMOTESPACES_G_NBI(char, shmem_ctx_char_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(unsigned char, shmem_ctx_uchar_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(short, shmem_ctx_short_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(unsigned short, shmem_ctx_ushort_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(int, shmem_ctx_int_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(unsigned int, shmem_ctx_uint_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(long, shmem_ctx_long_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(unsigned long, shmem_ctx_ulong_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(long long, shmem_ctx_longlong_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(unsigned long long, shmem_ctx_ulonglong_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(float, shmem_ctx_float_get_nbi)
+KOKKOS_REMOTESPACES_G_NBI(double, shmem_ctx_double_get_nbi)
+
+#undef KOKKOS_REMOTESPACES_G_NBI
+
 #define KOKKOS_REMOTESPACES_ATOMIC_SET(type, op)            \
   static KOKKOS_INLINE_FUNCTION void shmem_type_atomic_set( \
       type *ptr, type value, int pe) {                      \
-    return op(ptr, value, pe);                              \
+    return op(get_shmem_ctx(), ptr, value, pe);             \
   }
 
-KOKKOS_REMOTESPACES_ATOMIC_SET(int, shmem_int_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned int, shmem_uint_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(long, shmem_long_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long, shmem_ulong_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(long long, shmem_longlong_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long long, shmem_ulonglong_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(float, shmem_float_atomic_set)
-KOKKOS_REMOTESPACES_ATOMIC_SET(double, shmem_double_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(int, shmem_ctx_int_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned int, shmem_ctx_uint_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(long, shmem_ctx_long_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long, shmem_ctx_ulong_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(long long, shmem_ctx_longlong_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(unsigned long long,
+                               shmem_ctx_ulonglong_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(float, shmem_ctx_float_atomic_set)
+KOKKOS_REMOTESPACES_ATOMIC_SET(double, shmem_ctx_double_atomic_set)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_SET
 
 #define KOKKOS_REMOTESPACES_ATOMIC_FETCH(type, op)                      \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_fetch(type *ptr, \
                                                              int pe) {  \
-    return op(ptr, pe);                                                 \
+    return op(get_shmem_ctx(), ptr, pe);                                \
   }
 
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(int, shmem_int_atomic_fetch)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned int, shmem_uint_atomic_fetch)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(long, shmem_long_atomic_fetch)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long, shmem_ulong_atomic_fetch)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(long long, shmem_longlong_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(int, shmem_ctx_int_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned int, shmem_ctx_uint_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(long, shmem_ctx_long_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long, shmem_ctx_ulong_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(long long, shmem_ctx_longlong_atomic_fetch)
 KOKKOS_REMOTESPACES_ATOMIC_FETCH(unsigned long long,
-                                 shmem_ulonglong_atomic_fetch)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(float, shmem_float_atomic_fetch)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH(double, shmem_double_atomic_fetch)
+                                 shmem_ctx_ulonglong_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(float, shmem_ctx_float_atomic_fetch)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH(double, shmem_ctx_double_atomic_fetch)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_FETCH
 
 #define KOKKOS_REMOTESPACES_ATOMIC_ADD(type, op)            \
   static KOKKOS_INLINE_FUNCTION void shmem_type_atomic_add( \
       type *ptr, type value, int pe) {                      \
-    return op(ptr, value, pe);                              \
+    return op(get_shmem_ctx(), ptr, value, pe);             \
   }
 
-KOKKOS_REMOTESPACES_ATOMIC_ADD(int, shmem_int_atomic_add)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned int, shmem_uint_atomic_add)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(long, shmem_long_atomic_add)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long, shmem_ulong_atomic_add)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(long long, shmem_longlong_atomic_add)
-KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long long, shmem_ulonglong_atomic_add)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(int, shmem_ctx_int_atomic_add)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned int, shmem_ctx_uint_atomic_add)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(long, shmem_ctx_long_atomic_add)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long, shmem_ctx_ulong_atomic_add)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(long long, shmem_ctx_longlong_atomic_add)
+KOKKOS_REMOTESPACES_ATOMIC_ADD(unsigned long long,
+                               shmem_ctx_ulonglong_atomic_add)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_ADD
 
 #define KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(type, op)            \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_fetch_add( \
       type *ptr, type value, int pe) {                            \
-    return op(ptr, value, pe);                                    \
+    return op(get_shmem_ctx(), ptr, value, pe);                   \
   }
 
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(int, shmem_int_atomic_fetch_add)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned int, shmem_uint_atomic_fetch_add)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long, shmem_long_atomic_fetch_add)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(int, shmem_ctx_int_atomic_fetch_add)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned int,
+                                     shmem_ctx_uint_atomic_fetch_add)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long, shmem_ctx_long_atomic_fetch_add)
 KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long,
-                                     shmem_ulong_atomic_fetch_add)
-KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long long, shmem_longlong_atomic_fetch_add)
+                                     shmem_ctx_ulong_atomic_fetch_add)
+KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(long long,
+                                     shmem_ctx_longlong_atomic_fetch_add)
 KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD(unsigned long long,
-                                     shmem_ulonglong_atomic_fetch_add)
+                                     shmem_ctx_ulonglong_atomic_fetch_add)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_FETCH_ADD
 
 #define KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(type, op)            \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_compare_swap( \
       type *ptr, type cond, type value, int pe) {                    \
-    return op(ptr, cond, value, pe);                                 \
+    return op(get_shmem_ctx(), ptr, cond, value, pe);                \
   }
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(int, shmem_int_atomic_compare_swap)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(int, shmem_ctx_int_atomic_compare_swap)
 KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned int,
-                                        shmem_uint_atomic_compare_swap)
-KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long, shmem_long_atomic_compare_swap)
+                                        shmem_ctx_uint_atomic_compare_swap)
+KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long,
+                                        shmem_ctx_long_atomic_compare_swap)
 KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long,
-                                        shmem_ulong_atomic_compare_swap)
+                                        shmem_ctx_ulong_atomic_compare_swap)
 KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(long long,
-                                        shmem_longlong_atomic_compare_swap)
+                                        shmem_ctx_longlong_atomic_compare_swap)
 KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP(unsigned long long,
-                                        shmem_ulonglong_atomic_compare_swap)
+                                        shmem_ctx_ulonglong_atomic_compare_swap)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_COMPARE_SWAP
 
 #define KOKKOS_REMOTESPACES_ATOMIC_SWAP(type, op)            \
   static KOKKOS_INLINE_FUNCTION type shmem_type_atomic_swap( \
       type *ptr, type value, int pe) {                       \
-    return op(ptr, value, pe);                               \
+    return op(get_shmem_ctx(), ptr, value, pe);              \
   }
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(int, shmem_int_atomic_swap)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned int, shmem_uint_atomic_swap)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(long, shmem_long_atomic_swap)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long, shmem_ulong_atomic_swap)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(long long, shmem_longlong_atomic_swap)
-KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long long, shmem_ulonglong_atomic_swap)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(int, shmem_ctx_int_atomic_swap)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned int, shmem_ctx_uint_atomic_swap)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(long, shmem_ctx_long_atomic_swap)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long, shmem_ctx_ulong_atomic_swap)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(long long, shmem_ctx_longlong_atomic_swap)
+KOKKOS_REMOTESPACES_ATOMIC_SWAP(unsigned long long,
+                                shmem_ctx_ulonglong_atomic_swap)
 
 #undef KOKKOS_REMOTESPACES_ATOMIC_SWAP
 
@@ -204,8 +299,13 @@ struct SHMEMDataElement<
   T *ptr;
   int pe;
 
+  // Atomics are always issued through SHMEM, even if the element is directly
+  // accessible, as SHMEM atomics are not atomic with respect to processor
+  // atomics
   KOKKOS_INLINE_FUNCTION
-  SHMEMDataElement(T *ptr_, int pe_, int i_) : ptr(ptr_ + i_), pe(pe_) {}
+  SHMEMDataElement(T *ptr_, int pe_, size_t i_, T * = nullptr,
+                   char * = nullptr, size_t = 0)
+      : ptr(ptr_ + i_), pe(pe_) {}
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
@@ -520,302 +620,327 @@ struct SHMEMDataElement<
   typedef T non_const_value_type;
   T *ptr;
   int pe;
+  // Element address if directly accessible through load/store, else nullptr
+  T *direct_ptr;
+  // Start and size in bytes of the allocation if reads go through the read
+  // cache (Cached allocation mode), else nullptr and 0
+  char *cache_base;
+  size_t cache_size;
+
+  KOKKOS_INLINE_FUNCTION
+  SHMEMDataElement(T *ptr_, int pe_, size_t i_, T *direct_ptr_ = nullptr,
+                   char *cache_base_ = nullptr, size_t cache_size_ = 0)
+      : ptr(ptr_ + i_),
+        pe(pe_),
+        direct_ptr(direct_ptr_),
+        cache_base(cache_base_),
+        cache_size(cache_size_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  T get() const {
+    if (direct_ptr) return *direct_ptr;
+    if (cache_size) return get_cached();
+    return shmem_type_g(ptr, pe);
+  }
+
+  // Reads through the read cache. A miss gets the whole cache line
+  T get_cached() const {
+    T val;
+    const size_t pos = reinterpret_cast<char *>(ptr) - cache_base;
+    get_read_cache().read(&val, cache_base, pe, pos, sizeof(T), cache_size,
+                          [&](char *dst, size_t line_pos, size_t n) {
+                            shmem_ctx_getmem(get_shmem_ctx(), dst,
+                                             cache_base + line_pos, n, pe);
+                          });
+    return val;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void put(const T &val) const {
+    // Drop the cached copy so later reads of this PE see the new value
+    if (!direct_ptr && cache_size)
+      get_read_cache().forget(cache_base, pe,
+                              reinterpret_cast<char *>(ptr) - cache_base,
+                              sizeof(T));
+    if (direct_ptr)
+      *direct_ptr = val;
+    else if (RemoteSpaces_MemoryTraits<
+                 typename Traits::memory_traits>::is_nonblocking)
+      shmem_type_p_nbi(ptr, val, pe);
+    else
+      shmem_type_p(ptr, val, pe);
+  }
 
+  // Reads the element into dst. With the NonBlocking trait the get is
+  // complete after the next fence, otherwise on return
   KOKKOS_INLINE_FUNCTION
-  SHMEMDataElement(T *ptr_, int pe_, int i_) : ptr(ptr_ + i_), pe(pe_) {}
+  void get_nbi(T *dst) const {
+    if (direct_ptr)
+      *dst = *direct_ptr;
+    else if (cache_size)
+      *dst = get_cached();
+    else if (RemoteSpaces_MemoryTraits<
+                 typename Traits::memory_traits>::is_nonblocking)
+      shmem_type_g_nbi(dst, ptr, pe);
+    else
+      *dst = shmem_type_g(ptr, pe);
+  }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator=(const_value_type &val) const {
-    shmem_type_p(ptr, val, pe);
+    put(val);
     return val;
   }
 
   KOKKOS_INLINE_FUNCTION
   void inc() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp++;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
   }
 
   KOKKOS_INLINE_FUNCTION
   void dec() const {
-    T tmp;
-    shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp--;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++() const {
-    T tmp;
-    shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp++;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp--;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator++(int) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp++;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator--(int) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp--;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp += val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp -= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp *= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp /= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp %= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp &= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp ^= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp |= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp <<= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     tmp >>= val;
-    shmem_type_p(ptr, tmp, pe);
+    put(tmp);
     return tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator+(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp + val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator-(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp - val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator*(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp * val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator/(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp / val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator%(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp % val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator!() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return !tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&&(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp && val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator||(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp || val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator&(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp & val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator|(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp | val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator^(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp ^ val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator~() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return ~tmp;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator<<(const unsigned int &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp << val;
   }
 
   KOKKOS_INLINE_FUNCTION
   const_value_type operator>>(const unsigned int &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp >> val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator==(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp == val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator!=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp != val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp >= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<=(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp <= val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator<(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp < val;
   }
 
   KOKKOS_INLINE_FUNCTION
   bool operator>(const_value_type &val) const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp > val;
   }
 
   KOKKOS_INLINE_FUNCTION
   operator const_value_type() const {
-    T tmp;
-    tmp = shmem_type_g(ptr, pe);
+    T tmp = get();
     return tmp;
   }
 };
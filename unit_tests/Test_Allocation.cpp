@@ -107,4 +107,58 @@ TEST(TEST_CATEGORY, test_allocate_symmetric_remote_view_by_rank) {
       9, 10, 7, 2, 1, 1);
 }
 
+#if defined(KOKKOS_ENABLE_MPISPACE_WINDOW_CACHE)
+TEST(TEST_CATEGORY, test_window_cache) {
+  int numRanks;
+  MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+
+  using RemoteView_t = Kokkos::View<double **, RemoteMemSpace>;
+  { RemoteView_t view("MyRemoteView", numRanks, 1000); }
+
+  auto stats = RemoteMemSpace::get_window_cache_stats();
+  ASSERT_GE(stats.cached, 1u);
+
+  // A slightly smaller allocation falls into the same size class
+  { RemoteView_t view("MyRemoteView", numRanks, 990); }
+  ASSERT_EQ(RemoteMemSpace::get_window_cache_stats().hits, stats.hits + 1);
+  ASSERT_EQ(RemoteMemSpace::get_window_cache_stats().misses, stats.misses);
+}
+
+// Recycled windows of a sub-communicator hold the data of the new view
+TEST(TEST_CATEGORY, test_window_cache_reuse) {
+  int world_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+
+  MPI_Comm comm;
+  MPI_Comm_split(MPI_COMM_WORLD, world_rank % 2, world_rank, &comm);
+
+  int myRank, numRanks;
+  MPI_Comm_rank(comm, &myRank);
+  MPI_Comm_size(comm, &numRanks);
+
+  using RemoteView_t = Kokkos::View<int **, RemoteMemSpace>;
+  RemoteMemSpace space(comm);
+  const int size     = 1000;
+  const int nextRank = (myRank + 1) % numRanks;
+  auto stats         = RemoteMemSpace::get_window_cache_stats();
+
+  for (int round = 0; round < 4; ++round) {
+    RemoteView_t view(Kokkos::view_alloc("MyRemoteView", space), numRanks,
+                      size);
+    space.fence();
+    for (int i = 0; i < size; ++i) view(nextRank, i) = round * size + i;
+    space.fence();
+    int errors = 0;
+    for (int i = 0; i < size; ++i)
+      errors += view(myRank, i) != round * size + i;
+    space.fence();
+    ASSERT_EQ(0, errors);
+  }
+  ASSERT_EQ(RemoteMemSpace::get_window_cache_stats().hits, stats.hits + 3);
+
+  space.impl_release_window_cache();
+  MPI_Comm_free(&comm);
+}
+#endif
+
 #endif /* TEST_ALLOCATION_HPP_ */
@@ -50,6 +50,8 @@
 #include <gtest/gtest.h>
 #include <mpi.h>
 
+#include <cmath>
+
 using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
 
 template <class Data_t>
@@ -154,10 +156,34 @@ void test_atomic_globalview3D(int dim0, int dim1, int dim2) {
         ASSERT_EQ(v_h(i, j, l), num_ranks);
 }
 
+#if defined(KOKKOS_ENABLE_MPISPACE)
+// Multiplication is a compare-and-swap loop, for floating-point types too
+template <class Data_t>
+void test_atomic_multiply(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_2D_t = Kokkos::View<Data_t **, RemoteSpace_t,
+                                       Kokkos::MemoryTraits<Kokkos::Atomic>>;
+
+  ViewRemote_2D_t v("RemoteView", num_ranks, size);
+  for (int i = 0; i < size; ++i) v(my_rank, i) = 3;
+  RemoteSpace_t().fence();
+
+  // Every rank doubles all elements
+  for (int pe = 0; pe < num_ranks; ++pe)
+    for (int i = 0; i < size; ++i) v(pe, i) *= 2;
+  RemoteSpace_t().fence();
+
+  const Data_t ref = Data_t(std::ldexp(3.0, num_ranks));
+  for (int i = 0; i < size; ++i) ASSERT_EQ(ref, Data_t(v(my_rank, i)));
+  RemoteSpace_t().fence();
+}
+#endif
+
 TEST(TEST_CATEGORY, test_atomic_globalview) {
-#ifdef KOKKOS_ENABLE_MPISPACE
-// TODO: Requires implementing atomic RMA support in MPISpace
-#else
   // 1D
   test_atomic_globalview1D<int>(0);
   test_atomic_globalview1D<int>(1);
@@ -172,6 +198,11 @@ TEST(TEST_CATEGORY, test_atomic_globalview) {
   test_atomic_globalview3D<int>(1, 1, 1);
   test_atomic_globalview3D<int>(255, 1024, 3);
   test_atomic_globalview3D<int>(3, 33, 1024);
+
+#if defined(KOKKOS_ENABLE_MPISPACE)
+  test_atomic_multiply<int>(16);
+  test_atomic_multiply<float>(16);
+  test_atomic_multiply<double>(16);
 #endif
 }
 
@@ -217,6 +217,71 @@ void test_deepcopy(
       });
 }
 
+// A host view spanning the global dim0 of a remote view gathers the whole
+// view and stores the rows each PE owns
+template <class Data_t>
+void test_deepcopy_global(int i1, int i2,
+                          const RemoteSpace_t &space = RemoteSpace_t()) {
+  using ViewRemote_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using ViewHost_t   = Kokkos::View<Data_t **, Kokkos::HostSpace>;
+
+  ViewRemote_t v_R(Kokkos::view_alloc("RemoteView", space), i1, i2);
+  ViewHost_t v_H("HostView", i1, i2);
+
+  // The range ends with the last index of the calling PE
+  auto local_range = Kokkos::Experimental::get_local_range(i1, space);
+  const int first  = local_range.first;
+  const int last   = local_range.second;
+
+  auto policy = Kokkos::RangePolicy<>(first, last + 1);
+
+  Kokkos::parallel_for(
+      "Init", policy, KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < i2; ++j) v_R(i, j) = (Data_t)(i * i2 + j);
+      });
+
+  Kokkos::Experimental::RemoteSpaces::global_deep_copy(v_H, v_R);
+  for (int i = 0; i < i1; ++i)
+    for (int j = 0; j < i2; ++j) ASSERT_EQ((Data_t)(i * i2 + j), v_H(i, j));
+
+  // Rows owned by other PEs are not stored, so they may differ between PEs
+  for (int i = 0; i < i1; ++i)
+    for (int j = 0; j < i2; ++j)
+      v_H(i, j) = i >= first && i <= last ? (Data_t)(2 * (i * i2 + j))
+                                          : (Data_t)(-1);
+
+  Kokkos::Experimental::RemoteSpaces::global_deep_copy(v_R, v_H);
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      "Check", policy, KOKKOS_LAMBDA(const int i, int &err) {
+        for (int j = 0; j < i2; ++j) {
+          const Data_t val = v_R(i, j);
+          err += val != (Data_t)(2 * (i * i2 + j));
+        }
+      },
+      errors);
+  ASSERT_EQ(0, errors);
+}
+
+#if defined(KOKKOS_ENABLE_MPISPACE)
+// Global copies fence the communicator the remote view was allocated on
+template <class Data_t>
+void test_deepcopy_global_comm(int i1, int i2) {
+  int world_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+
+  MPI_Comm comm;
+  MPI_Comm_split(MPI_COMM_WORLD, world_rank % 2, world_rank, &comm);
+
+  RemoteSpace_t space(comm);
+  test_deepcopy_global<Data_t>(i1, i2, space);
+
+  space.impl_release_window_cache();
+  MPI_Comm_free(&comm);
+}
+#endif
+
 TEST(TEST_CATEGORY, test_deepcopy) {
   // scalar
   test_deepcopy<int, RemoteSpace_t, Kokkos::HostSpace>();
@@ -241,6 +306,16 @@ TEST(TEST_CATEGORY, test_deepcopy) {
   test_deepcopy<int64_t, Kokkos::HostSpace, RemoteSpace_t>(200, 100);
   test_deepcopy<double, RemoteSpace_t, Kokkos::HostSpace>(100, 300);
   test_deepcopy<double, Kokkos::HostSpace, RemoteSpace_t>(100, 300);
+
+  // Global
+  test_deepcopy_global<int>(1000, 1);
+  test_deepcopy_global<int64_t>(123, 7);
+  test_deepcopy_global<double>(1001, 17);
+
+#if defined(KOKKOS_ENABLE_MPISPACE)
+  test_deepcopy_global_comm<int>(1000, 1);
+  test_deepcopy_global_comm<double>(1001, 17);
+#endif
 }
 
 #endif /* TEST_DEEP_COPY_HPP_ */
\ No newline at end of file
@@ -0,0 +1,110 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_GATHER_HPP_
+#define TEST_GATHER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_gather_plan(int per_rank, int num_indices, int stride,
+                      size_t max_gap) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_1D_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using ViewIndex_t     = Kokkos::View<size_t *, Kokkos::HostSpace>;
+  using Plan_t =
+      Kokkos::Experimental::RemoteSpaces::GatherPlan<ViewRemote_1D_t>;
+
+  const int size      = per_rank * num_ranks;
+  ViewRemote_1D_t v   = ViewRemote_1D_t("RemoteView", size);
+  auto v_L            = Kokkos::Experimental::get_local_view(v);
+  ViewIndex_t indices = ViewIndex_t("Indices", num_indices);
+
+  for (int i = 0; i < per_rank; ++i)
+    v_L(i) = (Data_t)(my_rank * per_rank + i);
+
+  // Indices cross PE boundaries and repeat
+  for (int k = 0; k < num_indices; ++k)
+    indices(k) = (size_t(k) * stride + my_rank) % size;
+
+  Plan_t plan(v, indices, max_gap);
+  ASSERT_LE(plan.num_transfers(), size_t(num_indices));
+  plan.gather();
+
+  auto values = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    plan.values());
+  auto local_index = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         plan.local_index());
+
+  for (int k = 0; k < num_indices; ++k)
+    ASSERT_EQ(values(local_index(k)), (Data_t)indices(k));
+
+  // Later calls fetch the current values
+  for (int i = 0; i < per_rank; ++i) v_L(i) = (Data_t)(2 * v_L(i));
+  plan.gather();
+  Kokkos::deep_copy(values, plan.values());
+
+  for (int k = 0; k < num_indices; ++k)
+    ASSERT_EQ(values(local_index(k)), (Data_t)(2 * indices(k)));
+
+  RemoteSpace_t().fence();
+}
+
+TEST(TEST_CATEGORY, test_gather_plan) {
+  test_gather_plan<int>(1, 1, 1, 0);
+  test_gather_plan<int>(16, 100, 3, 0);
+  test_gather_plan<float>(64, 512, 5, 4);
+  test_gather_plan<double>(1024, 4096, 7, 16);
+}
+
+#endif /* TEST_GATHER_HPP_ */
@@ -50,6 +50,8 @@
 #include <gtest/gtest.h>
 #include <mpi.h>
 
+#include <vector>
+
 using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
 
 template <class Data_t>
@@ -166,6 +168,122 @@ void test_globalview3D(int dim0, int dim1, int dim2) {
       for (int k = 0; k < v_h.extent(2); ++k) ASSERT_EQ(v_h(i, j, k), 1);
 }
 
+// Global view with per-PE blocks rounded up to a power of two
+template <class Data_t>
+void test_globalview1D_pow2(int dim0) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using PowerOfTwo_t    = Kokkos::MemoryTraits<Kokkos::PowerOfTwoBlocks>;
+  using ViewRemote_1D_t = Kokkos::View<Data_t *, RemoteSpace_t, PowerOfTwo_t>;
+
+  ViewRemote_1D_t v = ViewRemote_1D_t("RemoteView", dim0);
+
+  const int block = v.extent(0);
+  ASSERT_EQ(block & (block - 1), 0);
+  ASSERT_GE(block * num_ranks, dim0);
+
+  for (int i = 0; i < block; ++i) v(my_rank * block + i) = my_rank * block + i;
+
+  RemoteSpace_t().fence();
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  for (int i = 0; i < block; ++i)
+    ASSERT_EQ(v(next_rank * block + i), (Data_t)(next_rank * block + i));
+
+  RemoteSpace_t().fence();
+}
+
+template <class Data_t, class Layout_t>
+void test_globalview1D_cyclic(int dim0) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_1D_t = Kokkos::View<Data_t *, Layout_t, RemoteSpace_t>;
+  const int block       = Layout_t::block_size;
+
+  ViewRemote_1D_t v = ViewRemote_1D_t("RemoteView", dim0);
+
+  // Each rank writes the global indices it owns
+  for (int i = 0; i < dim0; ++i)
+    if ((i / block) % num_ranks == my_rank) v(i) = i;
+
+  RemoteSpace_t().fence();
+
+  for (int i = 0; i < dim0; ++i) ASSERT_EQ(v(i), (Data_t)i);
+
+  RemoteSpace_t().fence();
+}
+
+template <class Data_t>
+void test_globalview1D_irregular(int scale) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_1D_t =
+      Kokkos::View<Data_t *, Kokkos::IrregularLayout, RemoteSpace_t>;
+
+  // Even ranks r own (r + 1) * scale indices, odd ranks own none
+  std::vector<size_t> pe_offsets(num_ranks + 1, 0);
+  for (int r = 0; r < num_ranks; ++r)
+    pe_offsets[r + 1] = pe_offsets[r] + (r % 2 ? 0 : (r + 1) * scale);
+  const size_t dim0 = pe_offsets[num_ranks];
+
+  ViewRemote_1D_t v =
+      ViewRemote_1D_t("RemoteView", Kokkos::IrregularLayout(pe_offsets.data()));
+  ASSERT_EQ(v.extent(0), pe_offsets[my_rank + 1] - pe_offsets[my_rank]);
+
+  for (size_t i = pe_offsets[my_rank]; i < pe_offsets[my_rank + 1]; ++i)
+    v(i) = i;
+
+  RemoteSpace_t().fence();
+
+  for (size_t i = 0; i < dim0; ++i) ASSERT_EQ(v(i), (Data_t)i);
+
+  RemoteSpace_t().fence();
+
+  // A layout giving the global extent is checked against the table
+  Kokkos::IrregularLayout sized(pe_offsets.data());
+  sized.dimension[0] = dim0;
+  ViewRemote_1D_t w("RemoteView", sized);
+  ASSERT_EQ(w.extent(0), v.extent(0));
+}
+
+template <class Data_t>
+void test_globalview2D_distributed_last(int dim0, int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using Layout_t        = Kokkos::DistributedLayoutLeft<1>;
+  using ViewRemote_2D_t = Kokkos::View<Data_t **, Layout_t, RemoteSpace_t>;
+
+  ViewRemote_2D_t v = ViewRemote_2D_t("RemoteView", dim0, dim1);
+
+  // Dim1 is split over the ranks and the local share is contiguous
+  const int block = v.extent(1);
+  ASSERT_EQ(v.extent(0), dim0);
+  ASSERT_GE(block * num_ranks, dim1);
+  ASSERT_EQ(v.span(), size_t(dim0) * block);
+
+  for (int j = my_rank * block; j < (my_rank + 1) * block && j < dim1; ++j)
+    for (int i = 0; i < dim0; ++i) v(i, j) = i + j * dim0;
+
+  RemoteSpace_t().fence();
+
+  for (int j = 0; j < dim1; ++j)
+    for (int i = 0; i < dim0; ++i) ASSERT_EQ(v(i, j), (Data_t)(i + j * dim0));
+
+  RemoteSpace_t().fence();
+}
+
 TEST(TEST_CATEGORY, test_globalview) {
   // 1D
   test_globalview1D<int>(0);
@@ -184,6 +302,26 @@ TEST(TEST_CATEGORY, test_globalview) {
   test_globalview3D<int>(1, 1, 1);
   test_globalview3D<float>(255, 1024, 3);
   test_globalview3D<double>(3, 33, 1024);
+
+  // Power-of-two blocks
+  test_globalview1D_pow2<int>(1);
+  test_globalview1D_pow2<int>(37);
+  test_globalview1D_pow2<double>(1024);
+
+  // Cyclic and block-cyclic layouts
+  test_globalview1D_cyclic<int, Kokkos::CyclicLayout>(1);
+  test_globalview1D_cyclic<int, Kokkos::CyclicLayout>(37);
+  test_globalview1D_cyclic<float, Kokkos::BlockCyclicLayout<4>>(37);
+  test_globalview1D_cyclic<double, Kokkos::BlockCyclicLayout<16>>(1024);
+
+  // Irregular partitions
+  test_globalview1D_irregular<int>(1);
+  test_globalview1D_irregular<double>(37);
+
+  // Distribution along the last dimension
+  test_globalview2D_distributed_last<int>(1, 1);
+  test_globalview2D_distributed_last<float>(17, 33);
+  test_globalview2D_distributed_last<double>(128, 64);
 }
 
 #endif /* TEST_GLOBALVIEW_HPP_ */
\ No newline at end of file
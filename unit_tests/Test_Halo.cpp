@@ -0,0 +1,103 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_HALO_HPP_
+#define TEST_HALO_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t, size_t Width>
+void test_exchange_halos(int dim0, int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using Layout_t        = Kokkos::HaloLayout<Width>;
+  using ViewRemote_2D_t = Kokkos::View<Data_t **, Layout_t, RemoteSpace_t>;
+
+  ViewRemote_2D_t v = ViewRemote_2D_t("RemoteView", dim0, dim1);
+  auto v_L          = Kokkos::Experimental::get_local_view(v);
+
+  const int block = v.extent(0);
+  const int width = Width;
+  ASSERT_EQ(v_L.extent(0), block + 2 * width);
+
+  // Owned rows follow the leading ghost rows
+  for (int i = 0; i < block; ++i)
+    for (int j = 0; j < dim1; ++j)
+      v_L(width + i, j) = (Data_t)((my_rank * block + i) * dim1 + j);
+
+  Kokkos::Experimental::RemoteSpaces::exchange_halos(v);
+
+  for (int i = 0; i < width; ++i)
+    for (int j = 0; j < dim1; ++j) {
+      if (my_rank > 0)
+        ASSERT_EQ(v_L(i, j),
+                  (Data_t)((my_rank * block - width + i) * dim1 + j));
+      if (my_rank < num_ranks - 1)
+        ASSERT_EQ(v_L(width + block + i, j),
+                  (Data_t)(((my_rank + 1) * block + i) * dim1 + j));
+    }
+
+  // Global indexing skips the ghost rows
+  int next_rank = (my_rank + 1) % num_ranks;
+  for (int i = next_rank * block; i < (next_rank + 1) * block && i < dim0; ++i)
+    for (int j = 0; j < dim1; ++j) ASSERT_EQ(v(i, j), (Data_t)(i * dim1 + j));
+
+  RemoteSpace_t().fence();
+}
+
+TEST(TEST_CATEGORY, test_exchange_halos) {
+  test_exchange_halos<int, 1>(4, 1);
+  test_exchange_halos<float, 2>(64, 3);
+  test_exchange_halos<double, 4>(1024, 16);
+}
+
+#endif /* TEST_HALO_HPP_ */
@@ -168,6 +168,130 @@ void test_localdeepcopy(
     for (int j = 0; j < i2; ++j) ASSERT_EQ(0x123, v_H(0, i, j));
 }
 
+// Partitions of other PEs are fetched and stored with one bulk transfer
+template <class Data_t>
+void test_localdeepcopy_partition(int i1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewHost_t = Kokkos::View<Data_t **, Kokkos::HostSpace>;
+  using ViewRemote_t =
+      Kokkos::View<Data_t **, Kokkos::PartitionedLayoutRight, RemoteSpace_t>;
+  using TeamPolicy_t = Kokkos::TeamPolicy<>;
+
+  ViewRemote_t v     = ViewRemote_t("RemoteView", num_ranks, i1);
+  ViewRemote_t v_get = ViewRemote_t("RemoteView", num_ranks, i1);
+  ViewRemote_t v_put = ViewRemote_t("RemoteView", num_ranks, i1);
+  ViewHost_t v_H("HostView", 1, i1);
+
+  const int next = (my_rank + 1) % num_ranks;
+  const int prev = (my_rank + num_ranks - 1) % num_ranks;
+
+  Kokkos::parallel_for(
+      "Init", i1, KOKKOS_LAMBDA(const int j) {
+        v(my_rank, j) = (Data_t)(my_rank * i1 + j);
+      });
+
+  RemoteSpace_t().fence();
+
+  auto v_next     = Kokkos::subview(v, next, Kokkos::ALL);
+  auto v_mine     = Kokkos::subview(v, my_rank, Kokkos::ALL);
+  auto v_get_mine = Kokkos::subview(v_get, my_rank, Kokkos::ALL);
+  auto v_put_next = Kokkos::subview(v_put, next, Kokkos::ALL);
+
+  Kokkos::parallel_for(
+      "Team", TeamPolicy_t(1, Kokkos::AUTO),
+      KOKKOS_LAMBDA(typename TeamPolicy_t::member_type team) {
+        Kokkos::Experimental::RemoteSpaces::local_deep_copy(team, v_get_mine,
+                                                            v_next);
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+          Kokkos::Experimental::RemoteSpaces::local_deep_copy(v_put_next,
+                                                              v_mine);
+        });
+      });
+
+  RemoteSpace_t().fence();
+
+  Kokkos::deep_copy(v_H, v_get);
+  for (int j = 0; j < i1; ++j) ASSERT_EQ((Data_t)(next * i1 + j), v_H(0, j));
+
+  Kokkos::deep_copy(v_H, v_put);
+  for (int j = 0; j < i1; ++j) ASSERT_EQ((Data_t)(prev * i1 + j), v_H(0, j));
+}
+
+// Index ranges of a global view owned by another PE are fetched with one
+// transfer and strided subviews of them with one transfer per row
+template <class Data_t>
+void test_localdeepcopy_global(int i1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewHost_t     = Kokkos::View<Data_t **, Kokkos::HostSpace>;
+  using ViewHost1D_t   = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+  using ViewRemote_t   = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using ViewRemote1D_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using TeamPolicy_t   = Kokkos::TeamPolicy<>;
+
+  // Every PE owns two rows
+  ViewRemote_t v       = ViewRemote_t("RemoteView", 2 * num_ranks, i1);
+  ViewRemote_t v_row   = ViewRemote_t("RemoteView", num_ranks, i1);
+  ViewRemote_t v_cols  = ViewRemote_t("RemoteView", 2 * num_ranks, i1 / 2);
+  ViewRemote1D_t v_col = ViewRemote1D_t("RemoteView", 2 * num_ranks);
+
+  const int next = (my_rank + 1) % num_ranks;
+
+  Kokkos::parallel_for(
+      "Init", i1, KOKKOS_LAMBDA(const int j) {
+        for (int i = 2 * my_rank; i < 2 * my_rank + 2; ++i)
+          v(i, j) = (Data_t)(i * i1 + j);
+      });
+
+  RemoteSpace_t().fence();
+
+  auto rows_next = Kokkos::make_pair(2 * next, 2 * next + 2);
+  auto v_next_row =
+      Kokkos::subview(v, Kokkos::make_pair(2 * next + 1, 2 * next + 2),
+                      Kokkos::ALL);
+  auto v_next_cols =
+      Kokkos::subview(v, rows_next, Kokkos::make_pair(0, i1 / 2));
+  auto v_next_col = Kokkos::subview(v, rows_next, 0);
+
+  Kokkos::parallel_for(
+      "Team", TeamPolicy_t(1, Kokkos::AUTO),
+      KOKKOS_LAMBDA(typename TeamPolicy_t::member_type team) {
+        Kokkos::Experimental::RemoteSpaces::local_deep_copy(team, v_row,
+                                                            v_next_row);
+        Kokkos::Experimental::RemoteSpaces::local_deep_copy(team, v_cols,
+                                                            v_next_cols);
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+          Kokkos::Experimental::RemoteSpaces::local_deep_copy(v_col,
+                                                              v_next_col);
+        });
+      });
+
+  RemoteSpace_t().fence();
+
+  ViewHost_t v_H("HostView", 1, i1);
+  Kokkos::deep_copy(v_H, v_row);
+  for (int j = 0; j < i1; ++j)
+    ASSERT_EQ((Data_t)((2 * next + 1) * i1 + j), v_H(0, j));
+
+  ViewHost_t v_H_cols("HostView", 2, i1 / 2);
+  Kokkos::deep_copy(v_H_cols, v_cols);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < i1 / 2; ++j)
+      ASSERT_EQ((Data_t)((2 * next + i) * i1 + j), v_H_cols(i, j));
+
+  ViewHost1D_t v_H_col("HostView", 2);
+  Kokkos::deep_copy(v_H_col, v_col);
+  for (int i = 0; i < 2; ++i)
+    ASSERT_EQ((Data_t)((2 * next + i) * i1), v_H_col(i));
+}
+
 TEST(TEST_CATEGORY, test_localdeepcopy) {
   // Scalar
   test_localdeepcopy<int, Kokkos::HostSpace, RemoteSpace_t>();
@@ -183,6 +307,16 @@ TEST(TEST_CATEGORY, test_localdeepcopy) {
   test_localdeepcopy<int, Kokkos::HostSpace, RemoteSpace_t>(50, 20);
   test_localdeepcopy<int64_t, Kokkos::HostSpace, RemoteSpace_t>(150, 99);
   test_localdeepcopy<double, Kokkos::HostSpace, RemoteSpace_t>(1500, 2199);
+
+  // Partitions of other PEs
+  test_localdeepcopy_partition<int>(50);
+  test_localdeepcopy_partition<int64_t>(150);
+  test_localdeepcopy_partition<double>(1500);
+
+  // Index ranges and strided subviews of other PEs
+  test_localdeepcopy_global<int>(50);
+  test_localdeepcopy_global<int64_t>(150);
+  test_localdeepcopy_global<double>(1500);
 }
 
 #endif /* TEST_LOCAL_DEEP_COPY_HPP_ */
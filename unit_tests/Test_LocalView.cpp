@@ -0,0 +1,127 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_LOCALVIEW_HPP_
+#define TEST_LOCALVIEW_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t>
+void test_local_view_global(int dim0, int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_2D_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+
+  ViewRemote_2D_t v = ViewRemote_2D_t("RemoteView", dim0, dim1);
+  auto v_L          = Kokkos::Experimental::get_local_view(v);
+
+  ASSERT_EQ(v_L.data(), v.data());
+  ASSERT_EQ(v_L.extent(0), v.extent(0));
+  ASSERT_EQ(v_L.extent(1), v.extent(1));
+
+  const int block = v_L.extent(0);
+  Kokkos::parallel_for(
+      "Init", Kokkos::RangePolicy<>(0, block), KOKKOS_LAMBDA(const int i) {
+        for (int j = 0; j < dim1; ++j)
+          v_L(i, j) = (Data_t)((my_rank * block + i) * dim1 + j);
+      });
+
+  Kokkos::fence();
+  RemoteSpace_t().fence();
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  for (int i = next_rank * block; i < (next_rank + 1) * block && i < dim0; ++i)
+    for (int j = 0; j < dim1; ++j) ASSERT_EQ(v(i, j), (Data_t)(i * dim1 + j));
+
+  RemoteSpace_t().fence();
+}
+
+template <class Data_t>
+void test_local_view_partitioned(int dim1) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_2D_t =
+      Kokkos::View<Data_t **, Kokkos::PartitionedLayoutRight, RemoteSpace_t>;
+
+  ViewRemote_2D_t v = ViewRemote_2D_t("RemoteView", num_ranks, dim1);
+  auto v_L          = Kokkos::Experimental::get_local_view(v);
+
+  ASSERT_EQ(v_L.extent(0), 1);
+  ASSERT_EQ(v_L.extent(1), dim1);
+
+  Kokkos::parallel_for(
+      "Init", Kokkos::RangePolicy<>(0, dim1),
+      KOKKOS_LAMBDA(const int j) { v_L(0, j) = (Data_t)(my_rank * dim1 + j); });
+
+  Kokkos::fence();
+  RemoteSpace_t().fence();
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  for (int j = 0; j < dim1; ++j)
+    ASSERT_EQ(v(next_rank, j), (Data_t)(next_rank * dim1 + j));
+
+  RemoteSpace_t().fence();
+}
+
+TEST(TEST_CATEGORY, test_local_view) {
+  test_local_view_global<int>(1, 1);
+  test_local_view_global<float>(37, 5);
+  test_local_view_global<double>(1024, 16);
+
+  test_local_view_partitioned<int>(1);
+  test_local_view_partitioned<double>(1500);
+}
+
+#endif /* TEST_LOCALVIEW_HPP_ */
@@ -0,0 +1,99 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_READCACHE_HPP_
+#define TEST_READCACHE_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+#if defined(KOKKOS_ENABLE_MPISPACE) || defined(KOKKOS_ENABLE_SHMEMSPACE)
+template <class Data_t>
+void test_cached_reads(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  auto &cache        = Kokkos::Impl::get_read_cache();
+
+  RemoteSpace_t space;
+  space.impl_set_allocation_mode(Kokkos::Experimental::Cached);
+  RemoteView_t v(Kokkos::view_alloc("RemoteView", space), num_ranks, size);
+
+  for (int i = 0; i < size; ++i) v(my_rank, i) = (Data_t)(my_rank * size + i);
+  space.fence();
+
+  const int next_rank = (my_rank + 1) % num_ranks;
+  for (int pass = 0; pass < 2; ++pass)
+    for (int i = 0; i < size; ++i)
+      ASSERT_EQ(v(next_rank, i), (Data_t)(next_rank * size + i));
+
+  // The second pass is served from the cache
+  const size_t misses = cache.get_misses();
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(v(next_rank, i), (Data_t)(next_rank * size + i));
+  ASSERT_EQ(cache.get_misses(), misses);
+
+  // Fences drop the cached lines
+  for (int i = 0; i < size; ++i) v(my_rank, i) = (Data_t)(2 * i);
+  space.fence();
+  for (int i = 0; i < size; ++i) ASSERT_EQ(v(next_rank, i), (Data_t)(2 * i));
+
+  space.fence();
+}
+
+TEST(TEST_CATEGORY, test_cached_reads) {
+  test_cached_reads<int>(1);
+  test_cached_reads<int>(1024);
+  test_cached_reads<double>(4096);
+}
+#endif
+
+#endif /* TEST_READCACHE_HPP_ */
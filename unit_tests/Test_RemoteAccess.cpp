@@ -52,7 +52,7 @@
 
 using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
 
-template <class Data_t, class Space_t>
+template <class Data_t, class Space_t, class... Args>
 void test_remote_accesses(int size) {
   int my_rank;
   int num_ranks;
@@ -62,7 +62,7 @@ void test_remote_accesses(int size) {
   using TeamPolicy  = Kokkos::TeamPolicy<>;
   TeamPolicy policy = TeamPolicy(1, Kokkos::AUTO);
 
-  using RemoteView_t = Kokkos::View<Data_t **, Space_t>;
+  using RemoteView_t = Kokkos::View<Data_t **, Space_t, Args...>;
   using HostSpace_t  = Kokkos::View<Data_t **, Kokkos::HostSpace>;
   HostSpace_t v_H("HostView", 1, size);
 
@@ -86,12 +86,111 @@ void test_remote_accesses(int size) {
   ASSERT_EQ(check, ref);
 }
 
+#if defined(KOKKOS_ENABLE_MPISPACE)
+// Remote accesses within independent halves of MPI_COMM_WORLD
+template <class Data_t>
+void test_remote_accesses_comm(int size) {
+  int world_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
+
+  MPI_Comm comm;
+  MPI_Comm_split(MPI_COMM_WORLD, world_rank % 2, world_rank, &comm);
+
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(comm, &my_rank);
+  MPI_Comm_size(comm, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using HostSpace_t  = Kokkos::View<Data_t **, Kokkos::HostSpace>;
+  HostSpace_t v_H("HostView", 1, size);
+
+  RemoteSpace_t space(comm);
+  {
+    RemoteView_t v_R(Kokkos::view_alloc("RemoteView", space), num_ranks,
+                     size);
+    ASSERT_EQ(v_R.extent(0), size_t(num_ranks));
+
+    space.fence();
+
+    Kokkos::parallel_for(
+        "Update", size, KOKKOS_LAMBDA(const int i) {
+          v_R(num_ranks - my_rank - 1, i) = (Data_t)my_rank * size + i;
+        });
+
+    Kokkos::deep_copy(v_H, v_R);
+  }
+
+  Data_t check(0), ref(0);
+  for (int i = 0; i < size; i++) {
+    check += v_H(0, i);
+    ref += (num_ranks - my_rank - 1) * size + i;
+  }
+  ASSERT_EQ(check, ref);
+
+  // Index ranges are distributed over the ranks of comm
+  auto local_range =
+      Kokkos::Experimental::get_local_range(num_ranks * size, space);
+  ASSERT_EQ(local_range.first, size_t(my_rank * size));
+  ASSERT_EQ(local_range.second, size_t((my_rank + 1) * size - 1));
+
+  space.impl_release_window_cache();
+  MPI_Comm_free(&comm);
+}
+#endif
+
+#if defined(KOKKOS_ENABLE_SHMEMSPACE)
+// Non-blocking remote loads completed by fence
+template <class Data_t>
+void test_remote_get_nbi(int size) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using NonBlocking_t = Kokkos::MemoryTraits<Kokkos::NonBlocking>;
+  using RemoteView_t  = Kokkos::View<Data_t **, RemoteSpace_t, NonBlocking_t>;
+  using HostSpace_t   = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+  HostSpace_t v_H("HostView", size);
+
+  RemoteView_t v_R = RemoteView_t("RemoteView", num_ranks, size);
+
+  for (int i = 0; i < size; i++) v_R(my_rank, i) = (Data_t)my_rank * size + i;
+
+  RemoteSpace_t().fence();
+
+  int other_rank = num_ranks - my_rank - 1;
+  for (int i = 0; i < size; i++) v_R(other_rank, i).get_nbi(&v_H(i));
+
+  RemoteSpace_t().fence();
+
+  for (int i = 0; i < size; i++)
+    ASSERT_EQ(v_H(i), (Data_t)other_rank * size + i);
+}
+#endif
+
 TEST(TEST_CATEGORY, test_remote_accesses) {
   test_remote_accesses<int, RemoteSpace_t>(0);
   test_remote_accesses<int, RemoteSpace_t>(1);
   test_remote_accesses<float, RemoteSpace_t>(122);
   test_remote_accesses<int64_t, RemoteSpace_t>(4567);
   test_remote_accesses<double, RemoteSpace_t>(89);
+
+  // Non-blocking remote stores
+  using NonBlocking_t = Kokkos::MemoryTraits<Kokkos::NonBlocking>;
+  test_remote_accesses<int, RemoteSpace_t, NonBlocking_t>(1);
+  test_remote_accesses<double, RemoteSpace_t, NonBlocking_t>(4567);
+
+#if defined(KOKKOS_ENABLE_MPISPACE)
+  // Communicator-scoped memory space
+  test_remote_accesses_comm<int>(1);
+  test_remote_accesses_comm<double>(4567);
+#endif
+
+#if defined(KOKKOS_ENABLE_SHMEMSPACE)
+  test_remote_get_nbi<int>(1);
+  test_remote_get_nbi<double>(4567);
+#endif
 }
 
 #endif /* TEST_REMOTE_ACCESS_HPP_ */
\ No newline at end of file
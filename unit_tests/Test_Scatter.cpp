@@ -0,0 +1,107 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_SCATTER_HPP_
+#define TEST_SCATTER_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+#include <vector>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+template <class Data_t, class Op>
+void test_remote_scatter(int per_rank, int repeat) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using ViewRemote_1D_t = Kokkos::View<Data_t *, RemoteSpace_t>;
+  using Scatter_t =
+      Kokkos::Experimental::RemoteSpaces::RemoteScatterView<ViewRemote_1D_t,
+                                                             Op>;
+
+  const int size    = per_rank * num_ranks;
+  ViewRemote_1D_t v = ViewRemote_1D_t("RemoteView", size);
+  auto v_L          = Kokkos::Experimental::get_local_view(v);
+
+  for (int i = 0; i < per_rank; ++i) v_L(i) = (Data_t)1;
+
+  Scatter_t scatter(v);
+
+  // Every PE updates every index several times
+  Kokkos::parallel_for(
+      "Update", size * repeat, KOKKOS_LAMBDA(const int k) {
+        scatter.update(k % size, (Data_t)(k % size + 1));
+      });
+
+  scatter.contribute();
+
+  std::vector<Data_t> expected(per_rank, (Data_t)1);
+  for (int i = 0; i < per_rank; ++i)
+    for (int n = 0; n < num_ranks * repeat; ++n)
+      Op::join(expected[i], (Data_t)(my_rank * per_rank + i + 1));
+  for (int i = 0; i < per_rank; ++i) ASSERT_EQ(v_L(i), expected[i]);
+
+  // The buffer is empty after a contribution
+  scatter.contribute();
+  for (int i = 0; i < per_rank; ++i) ASSERT_EQ(v_L(i), expected[i]);
+
+  RemoteSpace_t().fence();
+}
+
+TEST(TEST_CATEGORY, test_remote_scatter) {
+  using namespace Kokkos::Experimental::RemoteSpaces;
+  test_remote_scatter<int, ScatterSum>(1, 1);
+  test_remote_scatter<int, ScatterSum>(16, 3);
+  test_remote_scatter<double, ScatterSum>(1024, 2);
+  test_remote_scatter<int, ScatterMax>(64, 2);
+  test_remote_scatter<float, ScatterMin>(64, 2);
+  test_remote_scatter<uint64_t, ScatterBitXor>(128, 3);
+}
+
+#endif /* TEST_SCATTER_HPP_ */
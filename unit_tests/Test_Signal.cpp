@@ -0,0 +1,97 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_SIGNAL_HPP_
+#define TEST_SIGNAL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+// Passes a block around the ring of PEs, synchronizing only with neighbors
+template <class Data_t>
+void test_put_signal(int size, int steps) {
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<Data_t **, RemoteSpace_t>;
+  using SignalView_t = Kokkos::View<uint64_t **, RemoteSpace_t>;
+  using HostSpace_t  = Kokkos::View<Data_t *, Kokkos::HostSpace>;
+
+  RemoteView_t v_R("RemoteView", num_ranks, size);
+  SignalView_t s_R("Signals", num_ranks, 1);
+  HostSpace_t v_H("HostView", size);
+
+  RemoteSpace_t().fence();
+
+  int next_rank = (my_rank + 1) % num_ranks;
+  int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+
+  for (int step = 1; step <= steps; ++step) {
+    for (int i = 0; i < size; ++i) v_H(i) = (Data_t)my_rank * step + i;
+
+    Kokkos::Experimental::RemoteSpaces::put_signal(v_R, v_H, s_R, step,
+                                                   next_rank);
+    Kokkos::Experimental::RemoteSpaces::wait_until(s_R, step);
+
+    for (int i = 0; i < size; ++i)
+      ASSERT_EQ(v_R(my_rank, i), (Data_t)prev_rank * step + i);
+
+    // The producer must not overwrite the block before it has been read
+    RemoteSpace_t().fence();
+  }
+}
+
+TEST(TEST_CATEGORY, test_put_signal) {
+  test_put_signal<int>(1, 1);
+  test_put_signal<int64_t>(150, 4);
+  test_put_signal<double>(1500, 8);
+}
+
+#endif /* TEST_SIGNAL_HPP_ */
@@ -0,0 +1,171 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 3.0
+//       Copyright (2020) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY NTESS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL NTESS OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Jan Ciesko (jciesko@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef TEST_SYMMETRICARENA_HPP_
+#define TEST_SYMMETRICARENA_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_RemoteSpaces.hpp>
+#include <Kokkos_RemoteSpaces_SymmetricArena.hpp>
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <vector>
+
+using RemoteSpace_t = Kokkos::Experimental::DefaultRemoteMemorySpace;
+
+// Offsets of a fixed sequence of allocations and deallocations
+std::vector<long> arena_offsets(Kokkos::Impl::SymmetricArena &arena) {
+  const char *base = arena.get_base();
+  std::vector<long> offsets;
+  void *a = arena.allocate(100);
+  void *b = arena.allocate(1000);
+  void *c = arena.allocate(64);
+  offsets.push_back(static_cast<char *>(a) - base);
+  offsets.push_back(static_cast<char *>(b) - base);
+  offsets.push_back(static_cast<char *>(c) - base);
+  arena.deallocate(b);
+  offsets.push_back(static_cast<char *>(arena.allocate(500)) - base);
+  offsets.push_back(static_cast<char *>(arena.allocate(3000)) - base);
+  offsets.push_back(static_cast<char *>(arena.allocate(200)) - base);
+  return offsets;
+}
+
+TEST(TEST_CATEGORY, test_symmetric_arena_offsets) {
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  // Every PE manages its own segment at a different address
+  std::vector<char> segment(1 << 16);
+  Kokkos::Impl::SymmetricArena arena(segment.data(), segment.size(), 64);
+  std::vector<long> offsets = arena_offsets(arena);
+  for (long offset : offsets) ASSERT_EQ(0, offset % 64);
+
+  // All PEs obtain the offsets of rank 0
+  const int n = offsets.size();
+  std::vector<long> all(n * num_ranks);
+  MPI_Allgather(offsets.data(), n, MPI_LONG, all.data(), n, MPI_LONG,
+                MPI_COMM_WORLD);
+  for (int r = 0; r < num_ranks; ++r)
+    for (int i = 0; i < n; ++i) ASSERT_EQ(all[i], all[r * n + i]);
+}
+
+TEST(TEST_CATEGORY, test_symmetric_arena_coalescing) {
+  std::vector<char> segment(1024);
+  Kokkos::Impl::SymmetricArena arena(segment.data(), segment.size(), 64);
+  char *base = arena.get_base();
+
+  void *a = arena.allocate(256);
+  void *b = arena.allocate(256);
+  void *c = arena.allocate(256);
+  void *d = arena.allocate(256);
+  ASSERT_EQ(base + 768, d);
+
+  // Freeing b and c leaves one block spanning both
+  ASSERT_TRUE(arena.deallocate(b));
+  ASSERT_TRUE(arena.deallocate(c));
+  void *bc = arena.allocate(512);
+  ASSERT_EQ(b, bc);
+
+  // A block merges with its neighbors on both sides
+  ASSERT_TRUE(arena.deallocate(a));
+  ASSERT_TRUE(arena.deallocate(d));
+  ASSERT_TRUE(arena.deallocate(bc));
+  ASSERT_EQ(base, arena.allocate(segment.size()));
+}
+
+TEST(TEST_CATEGORY, test_symmetric_arena_exhaustion) {
+  std::vector<char> segment(1024);
+  Kokkos::Impl::SymmetricArena arena(segment.data(), segment.size(), 64);
+
+  void *a = arena.allocate(1000);
+  ASSERT_NE(nullptr, a);
+  ASSERT_EQ(nullptr, arena.allocate(1));
+
+  // Unknown or already freed pointers are left to the caller
+  int other;
+  ASSERT_FALSE(arena.deallocate(&other));
+  ASSERT_TRUE(arena.deallocate(a));
+  ASSERT_FALSE(arena.deallocate(a));
+  ASSERT_NE(nullptr, arena.allocate(1));
+}
+
+// Allocations beyond the arena fall back to regular symmetric memory
+TEST(TEST_CATEGORY, test_symmetric_arena_fallback) {
+  const size_t arena_size = Kokkos::Impl::get_symmetric_arena_size();
+  if (!arena_size) return;
+
+  int my_rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  using RemoteView_t = Kokkos::View<int **, RemoteSpace_t>;
+  const int size     = 2 * arena_size / sizeof(int) + 1;
+
+  RemoteView_t fits("RemoteView", num_ranks, 1);
+  RemoteView_t exceeds("RemoteView", num_ranks, size);
+
+  const int next_rank = (my_rank + 1) % num_ranks;
+  Kokkos::parallel_for(
+      "Update", size, KOKKOS_LAMBDA(const int i) {
+        exceeds(next_rank, i) = my_rank + i;
+        if (i == 0) fits(next_rank, 0) = my_rank;
+      });
+  RemoteSpace_t().fence();
+
+  const int prev_rank = (my_rank + num_ranks - 1) % num_ranks;
+  int errors          = 0;
+  Kokkos::parallel_reduce(
+      "Check", size,
+      KOKKOS_LAMBDA(const int i, int &err) {
+        err += exceeds(my_rank, i) != prev_rank + i;
+      },
+      errors);
+  ASSERT_EQ(0, errors);
+  ASSERT_EQ(prev_rank, fits(my_rank, 0));
+  RemoteSpace_t().fence();
+}
+
+#endif /* TEST_SYMMETRICARENA_HPP_ */